@@ -103,37 +103,38 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include <iostream>
 #include <vector>
 
+#include "AllocationCounter.h"
+#include "BatchRenderer.h"
+#include "BoardLayout.h"
 #include "ErrorHandler.h"
-#include "Grid.h"
+#include "FixedTimestep.h"
+#include "FrameArena.h"
+#include "FrameStats.h"
+#include "GLState.h"
+#include "Game.h"
+#include "GridRenderer.h"
+#include "MemoryOverlay.h"
+#include "MemorySnapshot.h"
+#include "Profiler.h"
 #include "Renderer.h"
-#include "Tetromino.h"
+#include "Replay.h"
+#include "ResourceCache.h"
+#include "TetrominoRenderer.h"
+#include "UniformBuffer.h"
 #include "VertexBuffer.h"
+#include "glm/gtc/matrix_transform.hpp"
 
 bool isKeyPressed(GLFWwindow* window, int key) {
     return glfwGetKey(window, key) == GLFW_PRESS;
 }
 
-#include <cstdlib>  // For std::rand and std::srand
-#include <ctime>    // For std::time
-
-Tetromino SpawnRandomTetromino() {
-    // Seed the random number generator
-    std::srand(static_cast<unsigned int>(std::time(0)));
-
-    ShapeType shapes[] = {ShapeType::I, ShapeType::L, ShapeType::O};
-    ShapeType randomShape = shapes[std::rand() % 3];
-
-    int randomCol = std::rand() % 10;
-
-    // Create and return a new Tetromino with the random shape and position
-    Tetromino tetromino;
-    tetromino.SetShape(20, randomCol, randomShape);
-    return tetromino;
-}
-
 GLFWwindow* Initialize() {
     if (!glfwInit()) {
         std::cerr << "Failed to initialize GLFW!" << std::endl;
@@ -162,7 +163,20 @@ GLFWwindow* Initialize() {
     return window;
 }
 
-int main(void) {
+// Gameplay timings, in simulation ticks so they do not depend on the refresh rate
+constexpr double TICK_RATE = 60.0;
+constexpr double FALL_INTERVAL = 1.0;      // Seconds per gravity step
+constexpr double MOVE_REPEAT = 0.1;        // Seconds between repeats of a held left/right
+constexpr double SOFT_DROP_REPEAT = 0.05;  // Seconds between repeats of a held down
+
+constexpr double DEFAULT_REFRESH_RATE = 60.0;  // When the monitor does not report one.
+
+// Per-frame scratch memory; the frame loop must not touch the heap once warmed up
+constexpr size_t FRAME_ARENA_BYTES = 64 * 1024;
+constexpr size_t TITLE_LENGTH = 192;
+constexpr size_t MEMORY_LINE_LENGTH = 256;
+
+int main(int argc, char** argv) {
     GLFWwindow* window = Initialize();
     if (!window) {
         return -1;
@@ -172,46 +186,203 @@ int main(void) {
     ErrorHandler errorHandler;
     errorHandler.EnableDebugOutput();
 
-    Grid grid;
-    Tetromino tetromino = SpawnRandomTetromino();
+    // Tetrix [--record FILE] [--tick-rate HZ] [--trace FILE] [--memory-log SECONDS] [--frame-csv FILE]
+    const char* recordPath = nullptr;
+    const char* tracePath = nullptr;
+    const char* frameCsvPath = nullptr;
+    double tickRate = TICK_RATE;
+    double memoryLogInterval = 0.0;  // 0 logs nothing.
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--record")) {
+            recordPath = argv[i + 1];
+        } else if (!std::strcmp(argv[i], "--tick-rate")) {
+            tickRate = std::atof(argv[i + 1]);
+        } else if (!std::strcmp(argv[i], "--trace")) {
+            tracePath = argv[i + 1];
+        } else if (!std::strcmp(argv[i], "--memory-log")) {
+            memoryLogInterval = std::atof(argv[i + 1]);
+        } else if (!std::strcmp(argv[i], "--frame-csv")) {
+            frameCsvPath = argv[i + 1];
+        }
+    }
+
+#ifdef TETRIX_PROFILE
+    if (tracePath) Profiler::StartCapture();
+#else
+    if (tracePath) std::cerr << "Built without TETRIX_PROFILE: --trace records nothing" << std::endl;
+#endif
 
+    Game game(static_cast<uint64_t>(std::time(nullptr)));
     Renderer renderer;
 
-    double lastTime = glfwGetTime();
-    double fallInterval = 1;  // Tetromino falls every 0.5 seconds
+    // Values every program shares, uploaded once per frame
+    UniformBuffer frameUniforms(sizeof(FrameUniforms), UniformBlock::FRAME_BINDING);
+    FrameUniforms frame = {};
+    frame.projection = glm::ortho(0.0f, static_cast<float>(BoardLayout::WindowWidth), 0.0f,
+                                  static_cast<float>(BoardLayout::WindowHeight), -1.0f, 1.0f);
+    frame.cellSize = glm::vec2(BoardLayout::CellWidth, BoardLayout::CellHeight);
+
+    // Everything on screen goes through one batch: lines and pieces streamed, the board retained
+    ResourceCache resources;
+    BatchRenderer batch(game.GetGrid().GetCols() * game.GetGrid().GetRows(), 256, resources);
+    GridRenderer gridRenderer(game.GetGrid(), batch);
+    TetrominoRenderer tetrominoRenderer;
+    double lastStatsTime = glfwGetTime();
+
+    // Saved games play back with tetrix_sim --replay FILE
+    ReplayWriter recorder;
+    if (recordPath && !recorder.Open(recordPath, game.GetSeed())) {
+        std::cerr << "Failed to open replay file " << recordPath << std::endl;
+    }
+
+    FixedTimestep timestep(tickRate);
+    const int fallTicks = timestep.TicksFor(FALL_INTERVAL);
+    const int moveTicks = timestep.TicksFor(MOVE_REPEAT);
+    const int softDropTicks = timestep.TicksFor(SOFT_DROP_REPEAT);
+
+    uint64_t tick = 0;
+    int gravityTimer = 0;  // Ticks since the last gravity step
+    int repeatTimer = 0;   // Ticks until a held move repeats
+    bool rotateHeld = false;
+    bool rotateQueued = false;  // Latched per frame so a quick tap between ticks still counts
+    Tetromino previous = game.GetCurrent();
+
+    auto apply = [&](Input input) {
+        if (game.Apply(input)) recorder.RecordInput(timestep.TickToMilliseconds(tick), input);
+    };
 
+    FrameArena arena(FRAME_ARENA_BYTES);
+    FrameAllocationCheck allocationCheck;
+    uint64_t frameAllocations = 0;  // Heap allocations in the previous frame.
+
+    // F3 shows the memory overlay
+    bool showMemory = false;
+    bool memoryKeyHeld = false;
+    double lastMemoryLogTime = glfwGetTime();
+
+    // Swaps wait for vsync, so a frame's budget is one refresh of the monitor
+    GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+    const GLFWvidmode* mode = monitor ? glfwGetVideoMode(monitor) : nullptr;
+    FrameStats frameStats(1000.0 / (mode && mode->refreshRate > 0 ? mode->refreshRate : DEFAULT_REFRESH_RATE));
+
+    double lastTime = glfwGetTime();
     while (!glfwWindowShouldClose(window)) {
+        PROFILE_FRAME();
+        allocationCheck.Begin();
+        arena.Reset();
         double currentTime = glfwGetTime();
-        double deltaTime = currentTime - lastTime;
-
-        renderer.ClearScreen();
-        grid.Draw();
-        tetromino.Draw();
-
-        if (deltaTime >= fallInterval) {
-            if (grid.CanMoveTetromino(tetromino, true, false, false)) {
-                tetromino.MoveDown();
-            } else {
-                grid.PlaceTetromino(tetromino);
-                tetromino = SpawnRandomTetromino();
+        int ticks = timestep.Advance(currentTime - lastTime);
+        lastTime = currentTime;
+
+        bool rotatePressed = isKeyPressed(window, GLFW_KEY_UP);
+        rotateQueued |= rotatePressed && !rotateHeld;
+        rotateHeld = rotatePressed;
+
+        bool memoryKeyPressed = isKeyPressed(window, GLFW_KEY_F3);
+        showMemory ^= memoryKeyPressed && !memoryKeyHeld;
+        memoryKeyHeld = memoryKeyPressed;
+
+        for (int i = 0; i < ticks; i++, tick++) {
+            PROFILE_ZONE("Tick");
+            previous = game.GetCurrent();
+
+            // Handle user input
+            Input move = Input::Left;
+            int repeat = 0;  // Repeat interval of the held key, 0 if none
+            if (isKeyPressed(window, GLFW_KEY_LEFT)) {
+                repeat = moveTicks;
+            } else if (isKeyPressed(window, GLFW_KEY_RIGHT)) {
+                move = Input::Right;
+                repeat = moveTicks;
+            } else if (isKeyPressed(window, GLFW_KEY_DOWN)) {
+                move = Input::SoftDrop;
+                repeat = softDropTicks;
+            }
+
+            if (repeat == 0) {
+                repeatTimer = 0;  // Released: the next press moves straight away
+            } else if (repeatTimer-- <= 0) {
+                apply(move);
+                repeatTimer = repeat - 1;
+            }
+
+            if (rotateQueued) {
+                apply(Input::RotateCW);
+                rotateQueued = false;
+            }
+
+            if (++gravityTimer >= fallTicks) {
+                if (!game.IsGameOver()) {
+                    game.Step();
+                    recorder.RecordGravity(timestep.TickToMilliseconds(tick));
+                }
+                gravityTimer = 0;
             }
-            lastTime = currentTime;
         }
+        double simEnd = glfwGetTime();
+
+        {
+            PROFILE_ZONE("Render");
+            gridRenderer.Update(game.GetGrid(), batch);
+            tetrominoRenderer.Update(previous, game.GetCurrent(), timestep.GetAlpha());
+
+            GLState::ResetStats();
+            frame.time = static_cast<float>(currentTime);
+            frameUniforms.Update(&frame, sizeof(frame));
+
+            renderer.ClearScreen();
+            batch.Begin();
+            gridRenderer.Submit(game.GetGrid(), batch);
+            tetrominoRenderer.Submit(batch);
+            if (showMemory) MemoryOverlay::Submit(MemorySnapshot::Take(frameAllocations, batch.GetStats()), batch);
+            batch.End();
+        }
+        double renderEnd = glfwGetTime();
 
-        // Handle user input
-        if (isKeyPressed(window, GLFW_KEY_LEFT) && grid.CanMoveTetromino(tetromino, false, true, false)) {
-            tetromino.MoveLeft();
-        } else if (isKeyPressed(window, GLFW_KEY_RIGHT) && grid.CanMoveTetromino(tetromino, false, false, true)) {
-            tetromino.MoveRight();
-        } else if (isKeyPressed(window, GLFW_KEY_DOWN) && grid.CanMoveTetromino(tetromino, true, false, false)) {
-            tetromino.MoveDown();
+        if (memoryLogInterval > 0.0 && currentTime - lastMemoryLogTime >= memoryLogInterval) {
+            if (char* line = arena.AllocateArray<char>(MEMORY_LINE_LENGTH)) {
+                MemorySnapshot::Take(frameAllocations, batch.GetStats()).Format(line, MEMORY_LINE_LENGTH);
+                std::cout << "Memory: " << line << std::endl;
+            }
+            lastMemoryLogTime = currentTime;
         }
 
+        // Report the batch and frame times once a second in the title bar
+        if (currentTime - lastStatsTime >= 1.0) {
+            const BatchStats& stats = batch.GetStats();
+            const GLStateStats& state = GLState::GetStats();
+            FrameTimeSummary times = frameStats.Summarize();
+            if (char* title = arena.AllocateArray<char>(TITLE_LENGTH)) {
+                std::snprintf(title, TITLE_LENGTH,
+                              "Tetrix - %u draw calls, %u vertices, %u/%u GL state calls skipped per frame, p99 %.1f ms, %u janks",
+                              stats.drawCalls, stats.vertices, state.skipped, state.issued + state.skipped, times.p99, times.janks);
+                glfwSetWindowTitle(window, title);
+            }
+            lastStatsTime = currentTime;
+        }
 
-        glfwSwapBuffers(window);
+        double swapStart = glfwGetTime();
+        {
+            PROFILE_ZONE("Swap");
+            glfwSwapBuffers(window);
+        }
+        double swapEnd = glfwGetTime();
         glfwPollEvents();
+        frameAllocations = allocationCheck.End();
+
+        frameStats.Record((simEnd - currentTime) * 1000.0, (renderEnd - simEnd) * 1000.0, (swapEnd - swapStart) * 1000.0,
+                          (glfwGetTime() - currentTime) * 1000.0);
     }
 
+    frameStats.PrintSummary(std::cout);
+    if (frameCsvPath && !frameStats.WriteCsv(frameCsvPath)) std::cerr << "Cannot write " << frameCsvPath << std::endl;
+
+#ifdef TETRIX_PROFILE
+    Profiler::PrintStats(std::cout);
+    if (tracePath && !Profiler::WriteChromeTrace(tracePath)) std::cerr << "Cannot write " << tracePath << std::endl;
+#endif
+
+    recorder.Close();
     glfwTerminate();
     return 0;
 }
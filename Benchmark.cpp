@@ -0,0 +1,253 @@
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BoardLayout.h"
+#include "FrameArena.h"
+#include "GLAlgorithms.h"
+#include "Game.h"
+#include "Grid.h"
+#include "Planner.h"
+#include "ShaderSource.h"
+#include "Simulator.h"
+#include "Tetromino.h"
+#include "ThreadPool.h"
+#include "TranspositionTable.h"
+
+/*
+tetrix_bench: microbenchmarks of the game, planner and rasterization hot paths. Needs
+no display or GL context. Google Benchmark flags apply, e.g. to keep a run for
+comparing against a later one:
+
+    tetrix_bench --benchmark_out=bench.json --benchmark_out_format=json
+
+Build in Release; Debug numbers (-O0) say little.
+*/
+
+// CMake points this at the source tree; otherwise assume the build directory, like the game does
+#ifndef TETRIX_RESOURCE_DIR
+#define TETRIX_RESOURCE_DIR "../resources"
+#endif
+
+namespace {
+
+constexpr int STACK_ROWS = 8;      // Height of the mid-game stack most cases run against.
+constexpr int PLANNED_PIECES = 30;  // Pieces the planner places before its decision is timed.
+
+/// A board with its bottom `rows` rows full except the last column, the well a vertical I fills.
+Grid MakeStack(int rows) {
+    Grid grid;
+    for (int row = 0; row < rows; row++) {
+        for (int col = 0; col < grid.GetCols() - 1; col++) grid.SetCellState(col, row, 1);
+    }
+    return grid;
+}
+
+Tetromino MakePiece(ShapeType shape, int row, int col) {
+    Tetromino piece;
+    piece.SetShape(row, col, shape);
+    return piece;
+}
+
+void BM_CanMoveTetromino(benchmark::State& state) {
+    Grid grid = MakeStack(STACK_ROWS);
+    Tetromino piece = MakePiece(ShapeType::T, STACK_ROWS, 4);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(grid.CanMoveTetromino(piece, true, false, false));
+        benchmark::DoNotOptimize(grid.CanMoveTetromino(piece, false, true, false));
+        benchmark::DoNotOptimize(grid.CanMoveTetromino(piece, false, false, true));
+    }
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+BENCHMARK(BM_CanMoveTetromino);
+
+void BM_PlaceTetromino(benchmark::State& state) {
+    Grid grid = MakeStack(STACK_ROWS);
+    Tetromino piece = MakePiece(ShapeType::T, STACK_ROWS, 4);
+
+    // Placing the same cells again is a no-op for the board, so every iteration does the same work
+    for (auto _ : state) {
+        grid.PlaceTetromino(piece);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PlaceTetromino);
+
+/// Drops a vertical I into the well of an 8-row stack and clears four rows; includes restoring the stack.
+void BM_ClearLines_Tetris(benchmark::State& state) {
+    const Grid stack = MakeStack(STACK_ROWS);
+    Grid grid = stack;
+    Tetromino piece = MakePiece(ShapeType::I, 0, stack.GetCols() - 3);
+    piece.Rotate(true, {0, 0});  // Vertical in the box's third column, the board's last
+
+    grid.PlaceTetromino(piece);
+    if (grid.ClearLines().count != 4) {
+        state.SkipWithError("The I piece does not fill the well");
+        return;
+    }
+
+    for (auto _ : state) {
+        grid = stack;  // Same size, so the cell vector is copied without allocating
+        grid.PlaceTetromino(piece);
+        benchmark::DoNotOptimize(grid.ClearLines());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ClearLines_Tetris);
+
+/// The common case after a lock: nothing to clear.
+void BM_ClearLines_None(benchmark::State& state) {
+    Grid grid = MakeStack(STACK_ROWS);
+
+    for (auto _ : state) benchmark::DoNotOptimize(grid.ClearLines());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ClearLines_None);
+
+/// Turns of the freshly spawned piece, wall-kick search included.
+void BM_Rotate(benchmark::State& state) {
+    Game game(1);
+
+    for (auto _ : state) benchmark::DoNotOptimize(game.Rotate(true));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Rotate);
+
+void BM_DrawLine(benchmark::State& state, int x1, int y1, int x2, int y2) {
+    size_t count = GLAlgorithms::LinePointCount(x1, y1, x2, y2);
+    std::vector<float> points(2 * count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GLAlgorithms::DrawLine(x1, y1, x2, y2, points.data(), count));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_CAPTURE(BM_DrawLine, horizontal, 28, 3, 438, 3);
+BENCHMARK_CAPTURE(BM_DrawLine, vertical, 28, 3, 28, 867);
+BENCHMARK_CAPTURE(BM_DrawLine, diagonal, 28, 3, 438, 867);
+
+/// Point fill of a piece's four cells into the frame arena; what `Tetromino::CreateBox` used to build.
+void BM_PieceBoxes(benchmark::State& state) {
+    FrameArena arena(4 * 2 * BoardLayout::CellWidth * BoardLayout::CellHeight * sizeof(float));
+    Tetromino piece = MakePiece(ShapeType::T, Game::SpawnRow, 4);
+
+    for (auto _ : state) {
+        arena.Reset();
+        for (const auto& [row, col] : piece.GetBlockPositions()) {
+            size_t count = 0;
+            benchmark::DoNotOptimize(GLAlgorithms::FillRect(BoardLayout::CellX(col), BoardLayout::CellY(row),
+                                                            BoardLayout::CellWidth, BoardLayout::CellHeight, arena, count));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_PieceBoxes);
+
+/// Splitting the batch's quad shader into stages, from memory so disk speed does not count.
+void BM_ParseShader(benchmark::State& state) {
+    std::ifstream file(TETRIX_RESOURCE_DIR "/shaders/Quad.glsl");
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::string text = contents.str();
+    if (text.empty()) {
+        state.SkipWithError("Cannot read " TETRIX_RESOURCE_DIR "/shaders/Quad.glsl");
+        return;
+    }
+
+    for (auto _ : state) {
+        std::istringstream stream(text);
+        benchmark::DoNotOptimize(ShaderSource::Parse(stream));
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_ParseShader);
+
+/// One 60 Hz tick of play: a scripted input every few ticks, gravity, and a hard drop now and then.
+void BM_GameTick(benchmark::State& state) {
+    constexpr Input SCRIPT[] = {Input::Left, Input::RotateCW, Input::Left, Input::SoftDrop,
+                                Input::Right, Input::RotateCCW, Input::Right, Input::SoftDrop};
+    constexpr int SCRIPT_LENGTH = sizeof(SCRIPT) / sizeof(SCRIPT[0]);
+    constexpr int INPUT_TICKS = 6;   // A key press every 100 ms.
+    constexpr int FALL_TICKS = 20;   // Gravity three times a second.
+    constexpr int DROP_TICKS = 90;   // A hard drop every 1.5 s, so pieces lock and lines clear.
+
+    Game game(1);
+    uint64_t tick = 0;
+
+    for (auto _ : state) {
+        if (tick % INPUT_TICKS == 0) game.Apply(SCRIPT[(tick / INPUT_TICKS) % SCRIPT_LENGTH]);
+        if (tick % FALL_TICKS == 0) game.Step();
+        if (tick % DROP_TICKS == 0) game.HardDrop();
+        if (game.IsGameOver()) game.Reset();
+        tick++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GameTick);
+
+/**
+ * One planner decision at the default depth and beam width, each on a fresh position: the game
+ * moves on by the last decision between iterations, untimed. Arguments: pool threads (0 searches
+ * on the caller) and transposition table megabytes (0 for none).
+ */
+void BM_PlannerDecision(benchmark::State& state) {
+    std::unique_ptr<ThreadPool> pool;
+    std::unique_ptr<TranspositionTable> table;
+    PlannerConfig config;
+    if (state.range(0) > 0) {
+        pool = std::make_unique<ThreadPool>(static_cast<size_t>(state.range(0)));
+        config.pool = pool.get();
+    }
+    if (state.range(1) > 0) {
+        table = std::make_unique<TranspositionTable>(static_cast<size_t>(state.range(1)));
+        config.table = table.get();
+    }
+    Planner planner(config);
+    PlannerResult result;
+
+    auto play = [&](Game& game) {
+        Placement placement;
+        placement.path = result.path;
+        Simulator::ApplyPlacement(game, placement);
+    };
+
+    // Let the planner build up its own stack first, so the board looks like mid-game
+    Game game(1);
+    for (int i = 0; i < PLANNED_PIECES && planner.Plan(game, result); i++) play(game);
+    if (game.IsGameOver()) {
+        state.SkipWithError("The planner topped out while building the stack");
+        return;
+    }
+    const Game midGame = game;
+    if (table) table->Clear();
+
+    for (auto _ : state) {
+        bool planned = planner.Plan(game, result);
+        benchmark::DoNotOptimize(planned);
+
+        state.PauseTiming();
+        if (planned) play(game);
+        if (!planned || game.IsGameOver()) game = midGame;
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PlannerDecision)
+    ->Args({0, 0})
+    ->Args({0, 64})
+    ->Args({2, 0})
+    ->Args({4, 0})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
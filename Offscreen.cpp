@@ -0,0 +1,319 @@
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "BatchRenderer.h"
+#include "BoardLayout.h"
+#include "FrameStats.h"
+#include "Game.h"
+#include "GridRenderer.h"
+#include "MemoryOverlay.h"
+#include "MemorySnapshot.h"
+#include "OffscreenContext.h"
+#include "Planner.h"
+#include "Profiler.h"
+#include "Renderer.h"
+#include "Replay.h"
+#include "ResourceCache.h"
+#include "TetrominoRenderer.h"
+#include "ThreadPool.h"
+#include "UniformBuffer.h"
+#include "glm/gtc/matrix_transform.hpp"
+
+/*
+tetrix_offscreen: renders a scripted game with no window and times every frame.
+
+Usage: tetrix_offscreen [--frames N] [--seed S] [--replay FILE] [--dump DIR] [--dump-every K] [--trace FILE]
+
+The game is driven either by a recorded replay, played back on its own clock,
+or by the beam-search planner, one input per frame. Either way the same seed
+gives the same frames, so numbers from different builds are comparable.
+*/
+
+namespace {
+
+constexpr double FRAME_RATE = 60.0;  // Simulated frames per second of game time.
+
+/**
+ * @brief Feeds the game one frame's worth of scripted input.
+ */
+class ScriptedInput {
+   private:
+    ReplayReader m_Replay;
+    bool m_HasReplay = false;
+    ReplayEvent m_Pending;
+    bool m_HasPending = false;
+
+    Planner m_Planner;
+    PlannerResult m_Plan;
+    int m_PlanPiece = -1;  // Piece count the plan was made for.
+    int m_PlanStep = 0;
+
+   public:
+    explicit ScriptedInput(const PlannerConfig& config) : m_Planner(config) {}
+
+    bool OpenReplay(const char* path) {
+        m_HasReplay = m_Replay.Open(path);
+        m_HasPending = m_HasReplay && m_Replay.Next(m_Pending);
+        return m_HasReplay;
+    }
+
+    uint64_t GetSeed(uint64_t fallback) const { return m_HasReplay ? m_Replay.GetSeed() : fallback; }
+
+    /// Plays everything due by `frame`; false once the script has nothing left.
+    bool Advance(Game& game, int frame) {
+        if (game.IsGameOver()) return false;
+
+        if (m_HasReplay) {
+            if (!m_HasPending) return false;
+
+            uint64_t now = static_cast<uint64_t>(frame * 1000.0 / FRAME_RATE);
+            while (m_HasPending && m_Pending.time <= now) {
+                if (m_Pending.IsGravity()) {
+                    game.Step();
+                } else {
+                    game.Apply(m_Pending.GetInput());
+                }
+                m_HasPending = m_Replay.Next(m_Pending);
+            }
+            return true;
+        }
+
+        // One planned input per frame, replanning whenever a new piece spawns
+        if (m_PlanPiece != game.GetPieces()) {
+            if (!m_Planner.Plan(game, m_Plan)) return false;
+            m_PlanPiece = game.GetPieces();
+            m_PlanStep = 0;
+        }
+        if (m_PlanStep < m_Plan.path.length) {
+            game.Apply(m_Plan.path.inputs[m_PlanStep++]);
+        } else {
+            game.HardDrop();
+        }
+        return true;
+    }
+};
+
+void PrintUsage() {
+    std::cout << "Usage: tetrix_offscreen [--frames N] [--seed S] [--replay FILE] [--dump DIR] [--dump-every K]\n"
+              << "                        [--trace FILE] [--overlay] [--frame-csv FILE] [--planner-threads N]\n"
+              << "  --frames N      Frames to render (default 600)\n"
+              << "  --seed S        Game seed when playing with the planner (default 0)\n"
+              << "  --replay FILE   Drive the game from a recording instead of the planner\n"
+              << "  --dump DIR      Write frames to DIR/frame_NNNNN.ppm\n"
+              << "  --dump-every K  Only dump every K-th frame (default 1)\n"
+              << "  --trace FILE    Write a Chrome trace of the profiler zones (needs TETRIX_PROFILE)\n"
+              << "  --overlay       Draw the memory overlay, as F3 does in the game\n"
+              << "  --frame-csv FILE  Write per-frame input/render/finish times and janks to FILE\n"
+              << "  --planner-threads N  Spread each planner search over N worker threads (default 0: none)\n";
+}
+
+bool WritePPM(const std::string& path, const std::vector<unsigned char>& rgba, int width, int height) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    file << "P6\n" << width << ' ' << height << "\n255\n";
+    for (int y = height - 1; y >= 0; y--) {  // GL rows start at the bottom
+        for (int x = 0; x < width; x++) file.write(reinterpret_cast<const char*>(&rgba[(y * width + x) * 4]), 3);
+    }
+    return static_cast<bool>(file);
+}
+
+uint64_t HashPixels(const std::vector<unsigned char>& rgba) {
+    uint64_t hash = 14695981039346656037ull;  // FNV-1a
+    for (unsigned char byte : rgba) hash = (hash ^ byte) * 1099511628211ull;
+    return hash;
+}
+
+double Percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) return 0.0;
+    size_t rank = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int frameCount = 600;
+    uint64_t seed = 0;
+    const char* replayPath = nullptr;
+    std::string dumpDir;
+    int dumpEvery = 1;
+    const char* tracePath = nullptr;
+    bool overlay = false;
+    const char* frameCsvPath = nullptr;
+    size_t plannerThreads = 0;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--frames") && hasValue) {
+            frameCount = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--seed") && hasValue) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (!std::strcmp(argv[i], "--replay") && hasValue) {
+            replayPath = argv[++i];
+        } else if (!std::strcmp(argv[i], "--dump") && hasValue) {
+            dumpDir = argv[++i];
+        } else if (!std::strcmp(argv[i], "--dump-every") && hasValue) {
+            dumpEvery = std::max(1, std::atoi(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--trace") && hasValue) {
+            tracePath = argv[++i];
+        } else if (!std::strcmp(argv[i], "--overlay")) {
+            overlay = true;
+        } else if (!std::strcmp(argv[i], "--frame-csv") && hasValue) {
+            frameCsvPath = argv[++i];
+        } else if (!std::strcmp(argv[i], "--planner-threads") && hasValue) {
+            plannerThreads = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    // Declared first so every GL object below is released while the context is still current
+    OffscreenContext context(BoardLayout::WindowWidth, BoardLayout::WindowHeight);
+    if (!context.IsValid()) {
+        std::cerr << "Offscreen context failed: " << context.GetError() << std::endl;
+        return 1;
+    }
+
+    // Only one game is played, so its planner can have the other cores
+    std::unique_ptr<ThreadPool> plannerPool;
+    PlannerConfig plannerConfig;
+    if (plannerThreads > 0) {
+        plannerPool = std::make_unique<ThreadPool>(plannerThreads);
+        plannerConfig.pool = plannerPool.get();
+    }
+
+    ScriptedInput input(plannerConfig);
+    if (replayPath && !input.OpenReplay(replayPath)) {
+        std::cerr << "Not a replay file: " << replayPath << std::endl;
+        return 1;
+    }
+    Game game(input.GetSeed(seed));
+
+#ifdef TETRIX_PROFILE
+    if (tracePath) Profiler::StartCapture();
+#else
+    if (tracePath) std::cerr << "Built without TETRIX_PROFILE: --trace records nothing" << std::endl;
+#endif
+
+    // Same scene setup as the game window
+    UniformBuffer frameUniforms(sizeof(FrameUniforms), UniformBlock::FRAME_BINDING);
+    FrameUniforms frame = {};
+    frame.projection = glm::ortho(0.0f, static_cast<float>(BoardLayout::WindowWidth), 0.0f,
+                                  static_cast<float>(BoardLayout::WindowHeight), -1.0f, 1.0f);
+    frame.cellSize = glm::vec2(BoardLayout::CellWidth, BoardLayout::CellHeight);
+
+    Renderer renderer;
+    ResourceCache resources;
+    BatchRenderer batch(game.GetGrid().GetCols() * game.GetGrid().GetRows(), 256, resources);
+    GridRenderer gridRenderer(game.GetGrid(), batch);
+    TetrominoRenderer tetrominoRenderer;
+
+    std::vector<double> frameTimes;
+    frameTimes.reserve(frameCount);
+    std::vector<unsigned char> pixels;
+    int dumped = 0;
+
+    // Planner and replay input may allocate; the rendering half of each frame must not
+    FrameAllocationCheck allocationCheck;
+    uint64_t renderAllocations = 0;
+    uint64_t frameAllocations = 0;
+
+    // Budgeted like a 60 Hz display; input (the planner) counts as the sim phase, glFinish as the swap
+    FrameStats frameStats(1000.0 / FRAME_RATE);
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    for (int i = 0; i < frameCount; i++) {
+        PROFILE_FRAME();
+        auto inputStart = std::chrono::steady_clock::now();
+        if (!input.Advance(game, i)) break;
+
+        // Timed from the first GL work of the frame until the GPU has finished it
+        auto start = std::chrono::steady_clock::now();
+        allocationCheck.Begin();
+
+        frame.time = static_cast<float>(i / FRAME_RATE);
+        frameUniforms.Update(&frame, sizeof(frame));
+        gridRenderer.Update(game.GetGrid(), batch);
+        tetrominoRenderer.Update(game.GetCurrent());
+
+        renderer.ClearScreen();
+        batch.Begin();
+        gridRenderer.Submit(game.GetGrid(), batch);
+        tetrominoRenderer.Submit(batch);
+        if (overlay) MemoryOverlay::Submit(MemorySnapshot::Take(frameAllocations, batch.GetStats()), batch);
+        batch.End();
+        auto submitted = std::chrono::steady_clock::now();
+        glFinish();
+        frameAllocations = allocationCheck.End();
+        renderAllocations += frameAllocations;
+
+        auto finished = std::chrono::steady_clock::now();
+        Milliseconds elapsed = finished - start;
+        frameTimes.push_back(elapsed.count());
+        frameStats.Record(Milliseconds(start - inputStart).count(), Milliseconds(submitted - start).count(),
+                          Milliseconds(finished - submitted).count(), Milliseconds(finished - inputStart).count());
+
+        if (!dumpDir.empty() && i % dumpEvery == 0) {
+            char name[32];
+            std::snprintf(name, sizeof(name), "/frame_%05d.ppm", i);
+            context.ReadPixels(pixels);
+            if (!WritePPM(dumpDir + name, pixels, context.GetWidth(), context.GetHeight())) {
+                std::cerr << "Cannot write " << dumpDir + name << std::endl;
+                return 1;
+            }
+            dumped++;
+        }
+    }
+
+    context.ReadPixels(pixels);
+
+    std::vector<double> sorted = frameTimes;
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0.0;
+    for (double ms : frameTimes) total += ms;
+    double mean = frameTimes.empty() ? 0.0 : total / frameTimes.size();
+
+    std::cout << "Renderer    : " << glGetString(GL_RENDERER) << "\n"
+              << "Input       : " << (replayPath ? replayPath : "planner") << " (seed " << game.GetSeed() << ")\n"
+              << "Frames      : " << frameTimes.size() << (dumped ? " (" + std::to_string(dumped) + " dumped)" : "") << "\n"
+              << "Pieces      : " << game.GetPieces() << ", lines: " << game.GetLines() << "\n"
+              << "Draw calls  : " << batch.GetStats().drawCalls << " per frame\n"
+              << "FPS         : " << (total > 0.0 ? 1000.0 * frameTimes.size() / total : 0.0) << "\n"
+              << "Frame ms    : mean " << mean << ", p50 " << Percentile(sorted, 0.50) << ", p90 "
+              << Percentile(sorted, 0.90) << ", p99 " << Percentile(sorted, 0.99) << ", max "
+              << (sorted.empty() ? 0.0 : sorted.back()) << "\n"
+              << "Last frame  : " << std::hex << HashPixels(pixels) << std::dec << std::endl;
+    char memory[256];
+    MemorySnapshot::Take(frameAllocations, batch.GetStats()).Format(memory, sizeof(memory));
+    std::cout << "Memory      : " << memory << std::endl;
+    if (AllocationCounter::IsEnabled()) {
+        std::cout << "Allocations : " << renderAllocations << " while rendering (warm-up included)" << std::endl;
+    }
+    frameStats.PrintSummary(std::cout);
+    if (frameCsvPath && !frameStats.WriteCsv(frameCsvPath)) {
+        std::cerr << "Cannot write " << frameCsvPath << std::endl;
+        return 1;
+    }
+
+#ifdef TETRIX_PROFILE
+    Profiler::PrintStats(std::cout);
+    if (tracePath && !Profiler::WriteChromeTrace(tracePath)) {
+        std::cerr << "Cannot write " << tracePath << std::endl;
+        return 1;
+    }
+#endif
+    return 0;
+}
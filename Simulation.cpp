@@ -0,0 +1,164 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "Replay.h"
+#include "Simulator.h"
+#include "ThreadPool.h"
+#include "TranspositionTable.h"
+
+/*
+tetrix_sim: plays batches of headless games across every core.
+
+Usage: tetrix_sim [--games N] [--seed S] [--threads T] [--max-pieces P] [--csv FILE]
+                  [--policy random|beam] [--depth D] [--beam W] [--tt-mb M] [--planner-threads N]
+       tetrix_sim --replay FILE
+*/
+
+void PrintUsage() {
+    std::cout << "Usage: tetrix_sim [--games N] [--seed S] [--threads T] [--max-pieces P] [--csv FILE]\n"
+              << "                  [--policy random|beam] [--depth D] [--beam W] [--tt-mb M] [--planner-threads N]\n"
+              << "       tetrix_sim --replay FILE\n"
+              << "  --games N       Number of games to play (default 1000)\n"
+              << "  --seed S        First seed; games use S .. S + N - 1 (default 0)\n"
+              << "  --threads T     Worker threads, 0 for all cores (default 0)\n"
+              << "  --max-pieces P  End surviving games after P pieces (default 10000)\n"
+              << "  --csv FILE      Write one line per game to FILE\n"
+              << "  --policy NAME   random (default) or beam for the beam-search planner\n"
+              << "  --depth D       Planner look-ahead in pieces (default 3)\n"
+              << "  --beam W        Planner beam width (default 32)\n"
+              << "  --tt-mb M       Transposition table shared by all planners, in MB (default 0: none)\n"
+              << "  --planner-threads N  Spread each planner search over N more threads; for --games 1 or\n"
+              << "                  --threads 1, where games do not already fill the cores (default 0: none)\n"
+              << "  --replay FILE   Re-simulate a recorded game as fast as possible and print the result\n";
+}
+
+const char* EndReasonName(EndReason reason) {
+    switch (reason) {
+        case EndReason::TopOut:
+            return "top_out";
+        case EndReason::PieceLimit:
+            return "piece_limit";
+    }
+    return "unknown";
+}
+
+int PlayReplay(const char* path) {
+    ReplayReader reader;
+    if (!reader.Open(path)) {
+        std::cerr << "Not a replay file: " << path << std::endl;
+        return 1;
+    }
+
+    Game game(reader.GetSeed());
+    auto start = std::chrono::steady_clock::now();
+    uint64_t events = reader.Play(game);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Seed        : " << reader.GetSeed() << "\n"
+              << "Events      : " << events << "\n"
+              << "Score       : " << game.GetScore() << "\n"
+              << "Lines       : " << game.GetLines() << "\n"
+              << "Pieces      : " << game.GetPieces() << "\n"
+              << "Game over   : " << (game.IsGameOver() ? "yes" : "no") << "\n"
+              << "Board hash  : " << std::hex << game.GetGrid().GetHash() << std::dec << "\n"
+              << "Time        : " << elapsed.count() << " ms" << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc == 3 && !std::strcmp(argv[1], "--replay")) return PlayReplay(argv[2]);
+
+    SimConfig config;
+    PlannerConfig plannerConfig;
+    std::string csvPath;
+    std::string policyName = "random";
+    size_t tableMegabytes = 0;  // Leaf scores cost about as much to compute as to probe
+    size_t plannerThreads = 0;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--games") && hasValue) {
+            config.gameCount = std::strtoull(argv[++i], nullptr, 10);
+        } else if (!std::strcmp(argv[i], "--seed") && hasValue) {
+            config.firstSeed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (!std::strcmp(argv[i], "--threads") && hasValue) {
+            config.threads = std::strtoul(argv[++i], nullptr, 10);
+        } else if (!std::strcmp(argv[i], "--max-pieces") && hasValue) {
+            config.maxPieces = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--csv") && hasValue) {
+            csvPath = argv[++i];
+        } else if (!std::strcmp(argv[i], "--policy") && hasValue) {
+            policyName = argv[++i];
+        } else if (!std::strcmp(argv[i], "--depth") && hasValue) {
+            plannerConfig.depth = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--beam") && hasValue) {
+            plannerConfig.beamWidth = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--tt-mb") && hasValue) {
+            tableMegabytes = std::strtoull(argv[++i], nullptr, 10);
+        } else if (!std::strcmp(argv[i], "--planner-threads") && hasValue) {
+            plannerThreads = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    Policy policy;
+    std::unique_ptr<TranspositionTable> table;
+    std::unique_ptr<ThreadPool> plannerPool;
+    if (policyName == "random") {
+        policy = Policies::Random;
+    } else if (policyName == "beam") {
+        // Games already run in parallel, so planners search on their own thread unless asked otherwise
+        if (tableMegabytes > 0) {
+            table = std::make_unique<TranspositionTable>(tableMegabytes);
+            plannerConfig.table = table.get();
+        }
+        if (plannerThreads > 0) {
+            plannerPool = std::make_unique<ThreadPool>(plannerThreads);
+            plannerConfig.pool = plannerPool.get();
+        }
+        policy = Policies::Beam(plannerConfig);
+    } else {
+        PrintUsage();
+        return 1;
+    }
+
+    Simulator simulator(config);
+    SimReport report = simulator.Run(policy);
+
+    long totalScore = 0, totalLines = 0, totalPieces = 0, topOuts = 0;
+    for (const GameResult& result : report.results) {
+        totalScore += result.score;
+        totalLines += result.lines;
+        totalPieces += result.pieces;
+        topOuts += result.reason == EndReason::TopOut;
+    }
+
+    double games = report.results.empty() ? 1.0 : static_cast<double>(report.results.size());
+    std::cout << "Games       : " << report.results.size() << " (seeds " << config.firstSeed << " .. "
+              << config.firstSeed + config.gameCount - 1 << ")\n"
+              << "Threads     : " << report.threads << "\n"
+              << "Avg score   : " << totalScore / games << "\n"
+              << "Avg lines   : " << totalLines / games << "\n"
+              << "Avg pieces  : " << totalPieces / games << "\n"
+              << "Top outs    : " << topOuts << ", piece limit: " << report.results.size() - topOuts << "\n"
+              << "Time        : " << report.seconds << " s\n"
+              << "Games/sec   : " << report.gamesPerSecond << "\n"
+              << "Pieces/sec  : " << report.piecesPerSecond << std::endl;
+
+    if (!csvPath.empty()) {
+        std::ofstream csv(csvPath);
+        csv << "seed,score,lines,pieces,end_reason\n";
+        for (const GameResult& result : report.results) {
+            csv << result.seed << ',' << result.score << ',' << result.lines << ',' << result.pieces << ','
+                << EndReasonName(result.reason) << '\n';
+        }
+    }
+    return 0;
+}
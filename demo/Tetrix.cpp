@@ -28,6 +28,8 @@ const int PREVIEW_Y = START_Y + (GRID_ROWS - 4) * CELL_HEIGHT;
 const float INITIAL_FALL_DELAY = 0.5f;
 const float FAST_FALL_DELAY = 0.05f;
 const double MOVE_DELAY = 0.1;
+const double TICK_RATE = 60.0;     // Game logic runs at a fixed rate, whatever the refresh rate
+const int MAX_TICKS_PER_FRAME = 8;  // Drop the backlog after a long stall instead of catching up
 
 // Scoring System
 const int SCORE_SINGLE = 1;
@@ -63,8 +65,8 @@ struct InputState {
     bool rightPressed = false;
     bool rotatePressed = false;
     bool pausePressed = false;
-    double lastMoveTime = 0.0;
-    const double moveDelay = MOVE_DELAY;
+    int lastMoveTick = 0;
+    const int moveDelay = static_cast<int>(MOVE_DELAY * TICK_RATE);
 } inputState;
 
 // Tetromino shapes
@@ -540,7 +542,10 @@ int main() {
     Tetromino currentTetromino = GenerateTetromino();
     Tetromino nextTetromino = GenerateTetromino();
     float fallDelay = INITIAL_FALL_DELAY;
-    float lastFallTime = glfwGetTime();
+    int lastFallTick = 0;
+    int tick = 0;
+    double accumulator = 0.0;
+    double lastTime = glfwGetTime();
 
     std::cout << "Welcome to Tetrix!\nScore: 0\nControls:\n"
               << "←/→: Move left/right\n"
@@ -553,6 +558,8 @@ int main() {
     while (!glfwWindowShouldClose(window)) {
         glClear(GL_COLOR_BUFFER_BIT);
         double currentTime = glfwGetTime();
+        accumulator += currentTime - lastTime;
+        lastTime = currentTime;
 
         // Draw game over screen if game is over
         if (gameOver) {
@@ -576,26 +583,35 @@ int main() {
             }
         }
 
-        if (!gamePaused) {
+        // Run whole fixed ticks; the remainder waits for the next frame
+        int ticks = static_cast<int>(accumulator * TICK_RATE);
+        if (ticks > MAX_TICKS_PER_FRAME) {
+            ticks = MAX_TICKS_PER_FRAME;
+            accumulator = 0.0;
+        } else {
+            accumulator -= ticks / TICK_RATE;
+        }
+
+        for (int i = 0; i < ticks && !gamePaused && !gameOver; i++, tick++) {
             // Handle lateral movement with delay
-            if (currentTime - inputState.lastMoveTime >= inputState.moveDelay) {
+            if (tick - inputState.lastMoveTick >= inputState.moveDelay) {
                 if (inputState.leftPressed && CanMoveLeft(currentTetromino)) {
                     MoveLeft(currentTetromino);
-                    inputState.lastMoveTime = currentTime;
+                    inputState.lastMoveTick = tick;
                 }
                 if (inputState.rightPressed && CanMoveRight(currentTetromino)) {
                     MoveRight(currentTetromino);
-                    inputState.lastMoveTime = currentTime;
+                    inputState.lastMoveTick = tick;
                 }
                 if (inputState.rotatePressed) {
                     RotateTetromino(currentTetromino);
                     inputState.rotatePressed = false;
-                    inputState.lastMoveTime = currentTime;
+                    inputState.lastMoveTick = tick;
                 }
             }
 
             // Handle vertical movement
-            if (currentTime - lastFallTime >= fallDelay) {
+            if (tick - lastFallTick >= static_cast<int>(fallDelay * TICK_RATE)) {
                 if (CanMoveDown(currentTetromino)) {
                     MoveDown(currentTetromino);
                 } else {
@@ -605,7 +621,7 @@ int main() {
                     nextTetromino = GenerateTetromino();
                     CheckGameOver(currentTetromino);
                 }
-                lastFallTime = currentTime;
+                lastFallTick = tick;
             }
 
             // Handle fast drop
@@ -0,0 +1,44 @@
+# shader vertex
+# version 330 core
+
+layout(location = 0) in vec2 a_Corner;  // Unit quad corner, (0, 0) to (1, 1)
+layout(location = 1) in vec4 a_Rect;    // Per instance: board x, y, width, height in pixels
+layout(location = 2) in vec4 a_Color;   // Per instance: line color
+
+layout(std140) uniform Frame {
+    mat4 u_Projection;
+    vec2 u_CellSize;  // Pixel size of one cell
+    float u_Time;
+};
+
+out vec2 v_Local;  // Pixel position relative to the board's bottom-left corner
+out vec4 v_Color;
+
+void main() {
+    // Grow the quad by a pixel each side so the outer lines are whole
+    v_Local = a_Corner * (a_Rect.zw + 2.0) - 1.0;
+    v_Color = a_Color;
+    gl_Position = u_Projection * vec4(a_Rect.xy + v_Local, 0.0, 1.0);
+}
+
+# shader fragment
+# version 330 core
+
+layout(std140) uniform Frame {
+    mat4 u_Projection;
+    vec2 u_CellSize;  // Pixel size of one cell
+    float u_Time;
+};
+
+in vec2 v_Local;
+in vec4 v_Color;
+out vec4 FragColor;
+
+void main() {
+    // Distance to the nearest vertical and horizontal cell edge; lines are 2 px wide
+    vec2 offset = mod(v_Local + u_CellSize * 0.5, u_CellSize) - u_CellSize * 0.5;
+    vec2 distance = abs(offset);
+
+    if (min(distance.x, distance.y) > 1.0) discard;
+    FragColor = v_Color;
+};
@@ -0,0 +1,36 @@
+# shader vertex
+# version 330 core
+
+layout(location = 0) in vec2 a_Corner;  // Unit quad corner, (0, 0) to (1, 1)
+layout(location = 1) in vec4 a_Rect;    // Per instance: x, y, width, height in pixels
+layout(location = 2) in vec4 a_Color;   // Per instance: RGBA
+
+layout(std140) uniform Frame {
+    mat4 u_Projection;
+    vec2 u_CellSize;  // Pixel size of one cell
+    float u_Time;
+};
+
+out vec4 v_Color;
+
+void main() {
+    v_Color = a_Color;
+
+    // Transparent quads are empty slots: push them outside the clip volume so they are culled
+    if (a_Color.a == 0.0) {
+        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+        return;
+    }
+
+    gl_Position = u_Projection * vec4(a_Rect.xy + a_Corner * a_Rect.zw, 0.0, 1.0);
+}
+
+# shader fragment
+# version 330 core
+
+in vec4 v_Color;
+out vec4 FragColor;
+
+void main() {
+    FragColor = v_Color;
+};
@@ -0,0 +1,82 @@
+#include "Bitboard.h"
+
+#include <stdexcept>
+#include <string>
+
+Bitboard::Bitboard(int cols, int rows)
+    : m_Cols(cols), m_RowCount(rows) {
+    // A wider row would shift past the 16-bit mask, a taller board past the row array
+    if (cols < 1 || cols > MaxCols || rows < 1 || rows > MaxRows) {
+        throw std::invalid_argument("Bitboard size must be at most " + std::to_string(MaxCols) + "x" +
+                                    std::to_string(MaxRows));
+    }
+    uint16_t playfield = static_cast<uint16_t>(((1u << m_Cols) - 1) << WallBits);
+    m_EmptyRow = static_cast<uint16_t>(~playfield);
+    Reset();
+}
+
+void Bitboard::Reset() {
+    m_Rows.fill(m_EmptyRow);
+    m_Hash = 0;  // An empty board has no occupied cells to hash
+}
+
+uint64_t Bitboard::ComputeHash() const {
+    uint64_t hash = 0;
+    for (int row = 0; row < m_RowCount; row++) hash ^= RowHash(row, m_Rows[row]);
+    return hash;
+}
+
+bool Bitboard::IsOccupied(int col, int row) const {
+    return (m_Rows[row] >> (col + WallBits)) & 1u;
+}
+
+void Bitboard::Set(int col, int row) {
+    WriteRow(row, m_Rows[row] | static_cast<uint16_t>(1u << (col + WallBits)));
+}
+
+void Bitboard::Clear(int col, int row) {
+    WriteRow(row, m_Rows[row] & static_cast<uint16_t>(~(1u << (col + WallBits))));
+}
+
+bool Bitboard::Fits(const PieceMask& piece, int col, int row) const {
+    int shift = col + WallBits;
+    if (shift < 0 || shift > 16) return false;  // Entirely past the left or right wall
+
+    for (int i = 0; i < 4; i++) {
+        uint32_t bits = static_cast<uint32_t>(piece.rows[i]) << shift;
+        if (!bits) continue;
+
+        int r = row + i;
+        if (r < 0 || r >= m_RowCount) return false;  // Floor / top boundary
+        // Bits shifted past the 16-bit row land in the implicit right wall.
+        if (bits & (m_Rows[r] | 0xFFFF0000u)) return false;
+    }
+    return true;
+}
+
+void Bitboard::Place(const PieceMask& piece, int col, int row) {
+    int shift = col + WallBits;
+    for (int i = 0; i < 4; i++) {
+        if (piece.rows[i]) WriteRow(row + i, m_Rows[row + i] | static_cast<uint16_t>(piece.rows[i] << shift));
+    }
+}
+
+uint32_t Bitboard::ClearFullRows() {
+    uint32_t cleared = 0;
+    int write = 0;
+
+    for (int read = 0; read < m_RowCount; read++) {
+        if (m_Rows[read] == FullRow) {
+            cleared |= 1u << read;
+            continue;
+        }
+        if (write != read) WriteRow(write, m_Rows[read]);
+        write++;
+    }
+
+    // Rows that fell off the top are refilled empty
+    for (; write < m_RowCount; write++) {
+        WriteRow(write, m_EmptyRow);
+    }
+    return cleared;
+}
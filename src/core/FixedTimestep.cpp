@@ -0,0 +1,28 @@
+#include "FixedTimestep.h"
+
+#include <algorithm>
+#include <cmath>
+
+FixedTimestep::FixedTimestep(double ticksPerSecond, int maxTicksPerFrame)
+    : m_Step(1.0 / std::max(ticksPerSecond, 1.0)), m_MaxTicksPerFrame(std::max(maxTicksPerFrame, 1)) {
+}
+
+int FixedTimestep::Advance(double seconds) {
+    m_Accumulator += std::max(seconds, 0.0);
+
+    int ticks = static_cast<int>(m_Accumulator / m_Step);
+    if (ticks > m_MaxTicksPerFrame) {
+        // Too far behind to catch up without a visible burst; drop the backlog
+        ticks = m_MaxTicksPerFrame;
+        m_Accumulator = std::fmod(m_Accumulator, m_Step);
+    } else {
+        m_Accumulator -= ticks * m_Step;
+    }
+
+    m_Tick += ticks;
+    return ticks;
+}
+
+int FixedTimestep::TicksFor(double seconds) const {
+    return std::max(1, static_cast<int>(std::lround(seconds / m_Step)));
+}
@@ -0,0 +1,115 @@
+#include "Game.h"
+
+namespace {
+
+// Points for clearing 0..4 lines with a single piece
+constexpr int LINE_SCORES[] = {0, 1, 3, 5, 8};
+
+}  // namespace
+
+Game::Game(uint64_t seed)
+    : m_Generator(seed) {
+    Reset();
+}
+
+void Game::SpawnNextTetromino() {
+    ShapeType shape = m_Generator.Next();
+    m_Generator.Fill(PreviewCount);
+
+    m_Current.SetShape(SpawnRow, GetSpawnCol(shape, m_Grid.GetCols()), shape);
+}
+
+void Game::Reset() {
+    Reset(m_Generator.GetSeed());
+}
+
+void Game::Reset(uint64_t seed) {
+    m_Grid.Reset();
+    m_Generator.Reset(seed);
+    m_Score = 0;
+    m_Lines = 0;
+    m_Pieces = 0;
+    m_GameOver = false;
+
+    SpawnNextTetromino();
+}
+
+bool Game::MoveLeft() {
+    if (m_GameOver || !m_Grid.CanMoveTetromino(m_Current, false, true, false)) return false;
+    m_Current.MoveLeft();
+    return true;
+}
+
+bool Game::MoveRight() {
+    if (m_GameOver || !m_Grid.CanMoveTetromino(m_Current, false, false, true)) return false;
+    m_Current.MoveRight();
+    return true;
+}
+
+bool Game::MoveDown() {
+    if (m_GameOver || !m_Grid.CanMoveTetromino(m_Current, true, false, false)) return false;
+    m_Current.MoveDown();
+    return true;
+}
+
+bool Game::Rotate(bool clockwise) {
+    if (m_GameOver) return false;
+
+    std::optional<KickOffset> kick = m_Grid.FindRotationKick(m_Current, clockwise);
+    if (!kick) return false;
+
+    m_Current.Rotate(clockwise, *kick);
+    return true;
+}
+
+bool Game::Step() {
+    if (m_GameOver) return false;
+    if (MoveDown()) return false;
+
+    LockPiece();
+    return true;
+}
+
+void Game::HardDrop() {
+    if (m_GameOver) return;
+    while (m_Grid.CanMoveTetromino(m_Current, true, false, false)) {
+        m_Current.MoveDown();
+    }
+    LockPiece();
+}
+
+bool Game::Apply(Input input) {
+    switch (input) {
+        case Input::Left:
+            return MoveLeft();
+        case Input::Right:
+            return MoveRight();
+        case Input::SoftDrop:
+            return MoveDown();
+        case Input::RotateCW:
+            return Rotate(true);
+        case Input::RotateCCW:
+            return Rotate(false);
+        case Input::HardDrop:
+            if (m_GameOver) return false;
+            HardDrop();
+            return true;
+    }
+    return false;
+}
+
+void Game::LockPiece() {
+    m_Grid.PlaceTetromino(m_Current);
+    m_Pieces++;
+
+    LineClear cleared = m_Grid.ClearLines();
+    m_Lines += cleared.count;
+    m_Score += LINE_SCORES[cleared.count < 4 ? cleared.count : 4];
+
+    SpawnNextTetromino();
+
+    // Top out when the new piece has no room to appear
+    if (!m_Grid.CanPlace(m_Current.GetMask(), m_Current.GetCol(), m_Current.GetRow())) {
+        m_GameOver = true;
+    }
+}
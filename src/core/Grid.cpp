@@ -0,0 +1,90 @@
+#include "Grid.h"
+
+#include <algorithm>
+
+Grid::Grid(int cols, int rows)
+    : m_Cols(cols), m_Rows(rows), m_Board(cols, rows) {
+    m_CellStates.assign(m_Rows * m_Cols, 0);
+}
+
+void Grid::Reset() {
+    m_Board.Reset();
+    std::fill(m_CellStates.begin(), m_CellStates.end(), 0);
+    m_Revision++;
+}
+
+bool Grid::IsCellEmpty(int col, int row) const {
+    return !m_Board.IsOccupied(col, row);
+}
+
+int Grid::GetCellState(int col, int row) const {
+    return m_CellStates[row * m_Cols + col];
+}
+
+void Grid::SetCellState(int col, int row, int state) {
+    m_CellStates[row * m_Cols + col] = state;
+    if (state) {
+        m_Board.Set(col, row);
+    } else {
+        m_Board.Clear(col, row);
+    }
+    m_Revision++;
+}
+
+bool Grid::CanPlace(const PieceMask& piece, int col, int row) const {
+    return m_Board.Fits(piece, col, row);
+}
+
+bool Grid::CanMoveTetromino(const Tetromino& tetromino, bool bottom, bool left, bool right) const {
+    // Determine the direction of movement
+    int deltaRow = 0, deltaCol = 0;
+    if (bottom) deltaRow = -1;  // Moving down decreases the row
+    if (left) deltaCol = -1;    // Moving left decreases the column
+    if (right) deltaCol = 1;    // Moving right increases the column
+
+    // Boundaries and locked blocks are both covered by the row-mask test
+    return m_Board.Fits(tetromino.GetMask(), tetromino.GetCol() + deltaCol, tetromino.GetRow() + deltaRow);
+}
+
+std::optional<KickOffset> Grid::FindRotationKick(const Tetromino& tetromino, bool clockwise) const {
+    ShapeType shape = tetromino.GetShape();
+    int from = tetromino.GetRotation();
+    const PieceMask& mask = PieceTables::GetRotation(shape, PieceTables::NextRotation(from, clockwise)).mask;
+
+    for (const KickOffset& kick : PieceTables::GetKicks(shape, from, clockwise)) {
+        if (m_Board.Fits(mask, tetromino.GetCol() + kick.col, tetromino.GetRow() + kick.row)) return kick;
+    }
+    return std::nullopt;
+}
+
+void Grid::PlaceTetromino(const Tetromino& tetromino) {
+    m_Board.Place(tetromino.GetMask(), tetromino.GetCol(), tetromino.GetRow());
+    for (const auto& [row, col] : tetromino.GetBlockPositions()) {
+        m_CellStates[row * m_Cols + col] = 1;  // Mark as occupied
+    }
+    m_Revision++;
+}
+
+LineClear Grid::ClearLines() {
+    LineClear result;
+    result.rows = m_Board.ClearFullRows();
+    if (!result.rows) return result;
+
+    // Compact the cell states with the same stable row mapping as the bitboard
+    int* cells = m_CellStates.data();
+    int write = 0;
+    for (int read = 0; read < m_Rows; read++) {
+        if (result.IsRowCleared(read)) {
+            result.count++;
+            continue;
+        }
+        if (write != read) {
+            std::copy_n(cells + read * m_Cols, m_Cols, cells + write * m_Cols);
+        }
+        write++;
+    }
+    std::fill(cells + write * m_Cols, cells + m_Rows * m_Cols, 0);
+
+    m_Revision++;
+    return result;
+}
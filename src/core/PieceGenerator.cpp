@@ -0,0 +1,77 @@
+#include "PieceGenerator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+PieceGenerator::PieceGenerator(uint64_t seed) {
+    Reset(seed);
+}
+
+void PieceGenerator::Reset(uint64_t seed) {
+    m_Seed = seed;
+    m_Rng.Seed(seed);
+    m_BagIndex = SHAPE_COUNT;
+    m_QueueHead = 0;
+    m_QueueSize = 0;
+}
+
+void PieceGenerator::RefillBag() {
+    for (int i = 0; i < SHAPE_COUNT; i++) {
+        m_Bag[i] = static_cast<ShapeType>(i);
+    }
+
+    // Fisher-Yates shuffle
+    for (int i = SHAPE_COUNT - 1; i > 0; i--) {
+        std::swap(m_Bag[i], m_Bag[m_Rng.NextBelow(i + 1)]);
+    }
+    m_BagIndex = 0;
+}
+
+ShapeType PieceGenerator::DrawFromBag() {
+    if (m_BagIndex == SHAPE_COUNT) RefillBag();
+    return m_Bag[m_BagIndex++];
+}
+
+ShapeType PieceGenerator::Next() {
+    if (m_QueueSize == 0) return DrawFromBag();
+
+    ShapeType shape = m_Queue[m_QueueHead];
+    m_QueueHead = (m_QueueHead + 1) % MaxPreview;
+    m_QueueSize--;
+    return shape;
+}
+
+void PieceGenerator::Fill(int count) {
+    count = std::min(count, MaxPreview);
+    while (m_QueueSize < count) {
+        m_Queue[(m_QueueHead + m_QueueSize) % MaxPreview] = DrawFromBag();
+        m_QueueSize++;
+    }
+}
+
+ShapeType PieceGenerator::Peek(int index) {
+    // Past the queue's capacity the ring index would wrap onto a different piece
+    assert(index >= 0 && index < MaxPreview);
+    Fill(index + 1);
+    return m_Queue[(m_QueueHead + index) % MaxPreview];
+}
+
+void PieceGenerator::Skip(long count) {
+    for (; count > 0 && m_QueueSize > 0; count--) Next();
+
+    // Finish the current bag
+    long take = std::min<long>(count, SHAPE_COUNT - m_BagIndex);
+    m_BagIndex += static_cast<int>(take);
+    count -= take;
+
+    // Whole bags still need their shuffle so the generator stays in step
+    for (; count >= SHAPE_COUNT; count -= SHAPE_COUNT) {
+        RefillBag();
+        m_BagIndex = SHAPE_COUNT;
+    }
+    if (count > 0) {
+        RefillBag();
+        m_BagIndex = static_cast<int>(count);
+    }
+}
@@ -0,0 +1,24 @@
+#include "Random.h"
+
+void Xoshiro256::Jump() {
+    static constexpr uint64_t JUMP[] = {0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+                                        0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull};
+
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (uint64_t word : JUMP) {
+        for (int bit = 0; bit < 64; bit++) {
+            if (word & (1ull << bit)) {
+                s0 ^= m_State[0];
+                s1 ^= m_State[1];
+                s2 ^= m_State[2];
+                s3 ^= m_State[3];
+            }
+            Next();
+        }
+    }
+
+    m_State[0] = s0;
+    m_State[1] = s1;
+    m_State[2] = s2;
+    m_State[3] = s3;
+}
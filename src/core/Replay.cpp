@@ -0,0 +1,102 @@
+#include "Replay.h"
+
+#include <algorithm>
+#include <cstring>
+
+ReplayWriter::~ReplayWriter() {
+    Close();
+}
+
+bool ReplayWriter::Open(const std::string& path, uint64_t seed) {
+    Close();
+    m_File.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_File) return false;
+
+    m_LastTime = 0;
+    m_File.write(ReplayFormat::Magic, sizeof(ReplayFormat::Magic));
+    m_File.put(static_cast<char>(ReplayFormat::Version));
+    WriteVarint(seed);
+    return static_cast<bool>(m_File);
+}
+
+void ReplayWriter::Close() {
+    if (m_File.is_open()) m_File.close();
+}
+
+void ReplayWriter::WriteVarint(uint64_t value) {
+    // LEB128: seven bits per byte, high bit set on every byte but the last
+    char bytes[10];
+    int count = 0;
+    while (value >= 0x80) {
+        bytes[count++] = static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    bytes[count++] = static_cast<char>(value);
+    m_File.write(bytes, count);
+}
+
+void ReplayWriter::Record(const ReplayEvent& event) {
+    if (!m_File.is_open()) return;
+
+    uint64_t time = std::max(event.time, m_LastTime);
+    WriteVarint(((time - m_LastTime) << ReplayFormat::CodeBits) | event.code);
+    m_LastTime = time;
+}
+
+void ReplayWriter::Flush() {
+    if (m_File.is_open()) m_File.flush();
+}
+
+bool ReplayReader::Open(const std::string& path) {
+    m_File.open(path, std::ios::binary);
+    if (!m_File) return false;
+
+    char magic[sizeof(ReplayFormat::Magic)];
+    if (!m_File.read(magic, sizeof(magic)) || std::memcmp(magic, ReplayFormat::Magic, sizeof(magic)) != 0) return false;
+    if (m_File.get() != ReplayFormat::Version) return false;
+
+    m_LastTime = 0;
+    m_EventsRead = 0;
+    return ReadVarint(m_Seed);
+}
+
+bool ReplayReader::ReadVarint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int byte = m_File.get();
+        if (byte == std::char_traits<char>::eof()) return false;
+
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;  // More than ten bytes: not something we wrote
+}
+
+bool ReplayReader::Next(ReplayEvent& event) {
+    uint64_t value;
+    if (!ReadVarint(value)) return false;
+
+    event.code = static_cast<uint8_t>(value & ((1u << ReplayFormat::CodeBits) - 1));
+    if (event.code > static_cast<uint8_t>(Input::HardDrop) && !event.IsGravity()) return false;
+
+    m_LastTime += value >> ReplayFormat::CodeBits;
+    m_EventsRead++;
+    event.time = m_LastTime;
+    return true;
+}
+
+uint64_t ReplayReader::Play(Game& game) {
+    if (m_EventsRead == 0) game.Reset(m_Seed);
+
+    uint64_t count = 0;
+    ReplayEvent event;
+    while (Next(event)) {
+        if (event.IsGravity()) {
+            game.Step();
+        } else {
+            game.Apply(event.GetInput());
+        }
+        count++;
+    }
+    return count;
+}
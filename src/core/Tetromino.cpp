@@ -0,0 +1,44 @@
+#include "Tetromino.h"
+
+void Tetromino::SetShape(int baseRow, int baseCol, ShapeType shape) {
+    m_Shape = shape;
+    m_Rotation = 0;
+    m_Row = baseRow;
+    m_Col = baseCol;
+    UpdateBlocks();
+}
+
+void Tetromino::UpdateBlocks() {
+    const RotationState& state = PieceTables::GetRotation(m_Shape, m_Rotation);
+    for (int i = 0; i < 4; i++) {
+        m_BlockPositions[i] = {m_Row + state.blocks[i].row, m_Col + state.blocks[i].col};
+    }
+}
+
+void Tetromino::Rotate(bool clockwise, KickOffset kick) {
+    m_Rotation = PieceTables::NextRotation(m_Rotation, clockwise);
+    m_Row += kick.row;
+    m_Col += kick.col;
+    UpdateBlocks();
+}
+
+void Tetromino::MoveDown() {
+    for (auto& [row, col] : m_BlockPositions) {
+        row -= 1;  // Move row down by 1
+    }
+    m_Row -= 1;
+}
+
+void Tetromino::MoveLeft() {
+    for (auto& [row, col] : m_BlockPositions) {
+        col -= 1;  // Move column left by 1
+    }
+    m_Col -= 1;
+}
+
+void Tetromino::MoveRight() {
+    for (auto& [row, col] : m_BlockPositions) {
+        col += 1;  // Move column right by 1
+    }
+    m_Col += 1;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Zobrist.h"
+
+/**
+ * @struct PieceMask
+ * @brief A piece footprint stored as a stack of row masks.
+ *
+ * `rows[0]` is the bottom row of the piece's 4x4 box. Bit `c` of `rows[r]` is set
+ * when the cell at (origin row + r, origin col + c) is occupied.
+ */
+struct PieceMask {
+    std::array<uint16_t, 4> rows{};
+};
+
+/**
+ * @class Bitboard
+ * @brief Board occupancy stored as one 16-bit mask per row.
+ *
+ * Each row keeps the playfield columns in the middle bits and sets the remaining
+ * bits as walls, so a shifted piece row that overlaps either side fails the same
+ * AND test as one that overlaps a locked block. A full row is therefore `0xFFFF`.
+ *
+ * The board also keeps a Zobrist hash of its occupied cells, updated on every
+ * change, so searches can spot boards they have already seen.
+ */
+class Bitboard {
+   public:
+    static constexpr int MaxRows = 32;
+    static constexpr int MaxCols = 10;
+    static constexpr int WallBits = 3;  // Left wall width; wide enough for a 4-wide box at col -3.
+    static constexpr uint16_t FullRow = 0xFFFF;
+
+    static_assert(MaxRows <= Zobrist::Rows && MaxCols <= Zobrist::Cols, "Zobrist tables must cover the board");
+
+   private:
+    std::array<uint16_t, MaxRows> m_Rows;  // Row masks, bottom row first.
+    int m_Cols, m_RowCount;
+    uint16_t m_EmptyRow;                   // Wall bits only.
+    uint64_t m_Hash;                       // Zobrist hash of the occupied cells.
+
+    inline uint64_t RowHash(int row, uint16_t mask) const {
+        return Zobrist::RowKey(row, (mask >> WallBits) & ((1u << m_Cols) - 1));
+    }
+
+    /// Replaces a row mask and keeps the hash in step.
+    inline void WriteRow(int row, uint16_t mask) {
+        m_Hash ^= RowHash(row, m_Rows[row]) ^ RowHash(row, mask);
+        m_Rows[row] = mask;
+    }
+
+   public:
+    /// @throws std::invalid_argument if the board is empty or larger than `MaxCols` x `MaxRows`.
+    Bitboard(int cols, int rows);
+
+    inline int GetCols() const { return m_Cols; };
+    inline int GetRows() const { return m_RowCount; };
+
+    /// Removes every block, leaving only the walls.
+    void Reset();
+
+    bool IsOccupied(int col, int row) const;
+    void Set(int col, int row);
+    void Clear(int col, int row);
+
+    /**
+     * @brief Tests whether a piece fits with its box origin at (col, row).
+     *
+     * Cells outside the board (left, right, below the floor and above the top row)
+     * count as occupied.
+     */
+    bool Fits(const PieceMask& piece, int col, int row) const;
+
+    /// ORs the piece into the board. The caller is expected to have checked `Fits`.
+    void Place(const PieceMask& piece, int col, int row);
+
+    /**
+     * @brief Removes every full row and drops the rows above into the gaps.
+     *
+     * Full rows are found with a whole-row compare and the remaining rows are
+     * compacted downwards in a single stable pass.
+     *
+     * @return A mask with bit `r` set for every row `r` that was cleared.
+     */
+    uint32_t ClearFullRows();
+
+    /// @return The Zobrist hash of the occupied cells; equal boards always hash equal.
+    inline uint64_t GetHash() const { return m_Hash; };
+
+    /// Recomputes the hash from scratch, for checking the incremental updates.
+    uint64_t ComputeHash() const;
+
+    /// @return The raw row mask including wall bits.
+    inline uint16_t GetRowMask(int row) const { return m_Rows[row]; };
+    inline bool IsRowFull(int row) const { return m_Rows[row] == FullRow; };
+    inline bool IsRowEmpty(int row) const { return m_Rows[row] == m_EmptyRow; };
+
+    /// @return The number of set bits, e.g. rows in a `ClearFullRows` mask.
+    static inline int PopCount(uint32_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcount(bits);
+#else
+        int count = 0;
+        for (; bits; bits &= bits - 1) count++;
+        return count;
+#endif
+    }
+
+    /// @return The bits of a row mask that belong to the playfield (everything but the walls).
+    inline uint16_t GetPlayfieldMask() const { return static_cast<uint16_t>(~m_EmptyRow); };
+};
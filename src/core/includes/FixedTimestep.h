@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @class FixedTimestep
+ * @brief Turns variable frame times into a whole number of fixed simulation ticks.
+ *
+ * Each frame adds its elapsed time to an accumulator and the game runs one tick
+ * for every full step it holds. What is left over becomes `GetAlpha()`, the
+ * fraction of the way to the next tick, which the renderer blends with. Game
+ * logic therefore sees the same ticks at 30, 60 or 240 frames per second.
+ */
+class FixedTimestep {
+   private:
+    double m_Step;             // Seconds per tick.
+    double m_Accumulator = 0.0;
+    int m_MaxTicksPerFrame;
+    uint64_t m_Tick = 0;       // Ticks handed out so far.
+
+   public:
+    /**
+     * @param ticksPerSecond Simulation rate.
+     * @param maxTicksPerFrame Catch-up limit; after a long stall (a breakpoint, a
+     * dragged window) the backlog beyond this is dropped instead of replayed.
+     */
+    explicit FixedTimestep(double ticksPerSecond = 60.0, int maxTicksPerFrame = 8);
+
+    /**
+     * @brief Adds one frame's elapsed time.
+     *
+     * @return How many ticks to simulate before drawing this frame.
+     */
+    int Advance(double seconds);
+
+    /// Blend factor in [0, 1) between the previous tick's state and the current one.
+    inline float GetAlpha() const { return static_cast<float>(m_Accumulator / m_Step); };
+
+    inline uint64_t GetTick() const { return m_Tick; };
+    inline double GetStep() const { return m_Step; };
+    inline double GetTicksPerSecond() const { return 1.0 / m_Step; };
+
+    /// Ticks needed to cover `seconds`, at least one.
+    int TicksFor(double seconds) const;
+
+    /// Start of tick `tick` in milliseconds, for timestamps that must not depend on the wall clock.
+    inline uint64_t TickToMilliseconds(uint64_t tick) const { return static_cast<uint64_t>(tick * m_Step * 1000.0); };
+};
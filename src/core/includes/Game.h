@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Grid.h"
+#include "PieceGenerator.h"
+#include "Tetromino.h"
+
+/// A single player action, as produced by the keyboard, a replay or a bot.
+enum class Input : uint8_t { Left,
+                             Right,
+                             SoftDrop,
+                             RotateCW,
+                             RotateCCW,
+                             HardDrop };
+
+/**
+ * @class Game
+ * @brief Headless rules for a single game: the board, the falling piece, locking,
+ * line clears and scoring.
+ *
+ * Nothing here touches OpenGL, so a Game can be created and stepped without a
+ * window; the renderers only read its state.
+ */
+class Game {
+   public:
+    static constexpr int SpawnRow = 20;
+    static constexpr int PreviewCount = 5;  // Upcoming pieces kept visible in the queue.
+
+   private:
+    Grid m_Grid;
+    PieceGenerator m_Generator;
+    Tetromino m_Current;
+
+    int m_Score = 0;
+    int m_Lines = 0;
+    int m_Pieces = 0;
+    bool m_GameOver = false;
+
+    /// Takes the next piece from the generator and centres it at the top of the board.
+    void SpawnNextTetromino();
+
+    /// Locks the current piece, clears lines, scores and brings in the next piece.
+    void LockPiece();
+
+   public:
+    /**
+     * @param seed Seed for the piece sequence; the same seed always deals the same pieces.
+     */
+    explicit Game(uint64_t seed = 0);
+
+    /// Empties the board and starts a new game with the same seed.
+    void Reset();
+
+    /// Empties the board and starts a new game with a new seed.
+    void Reset(uint64_t seed);
+
+    bool MoveLeft();
+    bool MoveRight();
+    bool MoveDown();
+
+    /// Turns the current piece one step, trying the SRS wall kicks in order.
+    bool Rotate(bool clockwise = true);
+
+    /// Drops the current piece straight down and locks it.
+    void HardDrop();
+
+    /**
+     * @brief Performs one player action.
+     *
+     * @return True if the piece moved, turned or was dropped.
+     */
+    bool Apply(Input input);
+
+    /// Column the box of a freshly spawned piece starts in.
+    static inline int GetSpawnCol(ShapeType shape, int cols) { return (cols - PieceTables::GetPiece(shape).boxSize) / 2; };
+
+    /**
+     * @brief Applies one step of gravity.
+     *
+     * Moves the current piece down, or locks it if it is resting on something.
+     *
+     * @return True if the piece locked on this step.
+     */
+    bool Step();
+
+    inline const Grid& GetGrid() const { return m_Grid; };
+    inline const Tetromino& GetCurrent() const { return m_Current; };
+    inline const PieceGenerator& GetGenerator() const { return m_Generator; };
+    inline uint64_t GetSeed() const { return m_Generator.GetSeed(); };
+
+    /// @param index 0 is the next piece, up to `PreviewCount - 1`.
+    inline ShapeType GetPreview(int index) const { return m_Generator.GetQueued(index); };
+
+    inline int GetScore() const { return m_Score; };
+    inline int GetLines() const { return m_Lines; };
+    inline int GetPieces() const { return m_Pieces; };
+    inline bool IsGameOver() const { return m_GameOver; };
+};
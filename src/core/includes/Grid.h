@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "Bitboard.h"
+#include "Tetromino.h"
+
+/**
+ * @struct LineClear
+ * @brief Result of a line-clear pass, for scoring and clear animations.
+ */
+struct LineClear {
+    int count = 0;      // Number of rows removed.
+    uint32_t rows = 0;  // Bit `r` is set if row `r` (as it was before the clear) was full.
+
+    inline bool IsRowCleared(int row) const { return (rows >> row) & 1u; };
+};
+
+class Grid {
+   private:
+    int m_Cols, m_Rows;
+
+    Bitboard m_Board;               // Occupancy, one mask per row.
+    std::vector<int> m_CellStates;  // Per-cell state, row-major (row * m_Cols + col).
+    uint32_t m_Revision = 0;        // Bumped on every change so views know when to refresh.
+
+   public:
+    /// @throws std::invalid_argument if the size does not fit a `Bitboard`.
+    Grid(int cols = 10, int rows = 24);
+
+    inline int GetCols() const { return m_Cols; };
+    inline int GetRows() const { return m_Rows; };
+    inline uint32_t GetRevision() const { return m_Revision; };
+
+    /// Empties every cell.
+    void Reset();
+
+    bool IsCellEmpty(int col, int row) const;
+    int GetCellState(int col, int row) const;
+    void SetCellState(int col, int row, int state);
+    inline const Bitboard& GetBoard() const { return m_Board; };
+    inline uint64_t GetHash() const { return m_Board.GetHash(); };
+
+    bool CanPlace(const PieceMask& piece, int col, int row) const;
+    bool CanMoveTetromino(const Tetromino& tetromino, bool bottom, bool Left, bool Right) const;
+    void PlaceTetromino(const Tetromino& tetromino);
+
+    /**
+     * @brief Runs the SRS kick tests for turning a piece one step.
+     *
+     * @return The first kick that lets the turned piece fit, or nothing if all tests fail.
+     */
+    std::optional<KickOffset> FindRotationKick(const Tetromino& tetromino, bool clockwise) const;
+
+    /**
+     * @brief Removes every full row and drops the rows above it.
+     *
+     * Works in place in one pass over the board and never allocates.
+     *
+     * @return Which rows were cleared and how many.
+     */
+    LineClear ClearLines();
+};
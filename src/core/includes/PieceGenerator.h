@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "PieceTables.h"
+#include "Random.h"
+
+/**
+ * @class PieceGenerator
+ * @brief Seeded 7-bag piece randomizer with a preview queue.
+ *
+ * Every run of seven pieces contains each shape exactly once, in an order
+ * shuffled by the game's own `Xoshiro256`. The same seed always produces the
+ * same sequence, and no global state is touched.
+ */
+class PieceGenerator {
+   public:
+    static constexpr int MaxPreview = 16;  // Capacity of the preview queue.
+
+   private:
+    Xoshiro256 m_Rng;
+    uint64_t m_Seed;
+
+    std::array<ShapeType, SHAPE_COUNT> m_Bag;
+    int m_BagIndex;  // Next unused slot of the bag; SHAPE_COUNT when empty.
+
+    std::array<ShapeType, MaxPreview> m_Queue;  // Ring buffer of upcoming pieces.
+    int m_QueueHead, m_QueueSize;
+
+    void RefillBag();
+    ShapeType DrawFromBag();
+
+   public:
+    explicit PieceGenerator(uint64_t seed = 0);
+
+    /// Restarts the sequence from a new seed.
+    void Reset(uint64_t seed);
+
+    inline uint64_t GetSeed() const { return m_Seed; };
+
+    /// Removes and returns the next piece.
+    ShapeType Next();
+
+    /**
+     * @brief Makes sure at least `count` pieces are queued for preview.
+     *
+     * @param count Number of pieces, clamped to `MaxPreview`.
+     */
+    void Fill(int count);
+
+    /**
+     * @brief Looks at an upcoming piece without consuming it.
+     *
+     * @param index 0 is the piece `Next` will return, up to `MaxPreview - 1`; asserted.
+     */
+    ShapeType Peek(int index);
+
+    /**
+     * @brief Reads an already queued piece.
+     *
+     * @param index Must be below `GetQueuedCount()`; see `Fill`.
+     */
+    inline ShapeType GetQueued(int index) const { return m_Queue[(m_QueueHead + index) % MaxPreview]; };
+
+    /// Discards the next `count` pieces, e.g. to jump into the middle of a replay.
+    void Skip(long count);
+
+    inline int GetQueuedCount() const { return m_QueueSize; };
+};
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Bitboard.h"
+
+/*
+Piece tables
+All seven tetrominoes in their four SRS orientations, generated at compile time.
+
+Coordinates are relative to the bottom-left corner of the piece box, with rows
+growing upwards like the board. Rotation 0 is the spawn state, 1 is R (one turn
+clockwise), 2 is the 180 state and 3 is L.
+*/
+
+enum class ShapeType { I,
+                       J,
+                       L,
+                       O,
+                       S,
+                       T,
+                       Z };
+
+constexpr int SHAPE_COUNT = 7;
+constexpr int ROTATION_COUNT = 4;
+constexpr int KICK_COUNT = 5;
+
+struct BlockOffset {
+    int8_t row, col;
+};
+
+/// Translation tried when a rotation collides, in board (col, row) units.
+struct KickOffset {
+    int8_t col, row;
+};
+
+struct RotationState {
+    std::array<BlockOffset, 4> blocks;
+    PieceMask mask;
+};
+
+struct PieceDefinition {
+    int boxSize;                                           // Side of the square box the piece rotates in.
+    std::array<RotationState, ROTATION_COUNT> rotations;  // Indexed by rotation state.
+};
+
+namespace PieceTables {
+
+/// Builds the four orientations by turning the spawn state clockwise inside its box.
+constexpr PieceDefinition MakePiece(int boxSize, std::array<BlockOffset, 4> spawn) {
+    PieceDefinition piece{boxSize, {}};
+    std::array<BlockOffset, 4> blocks = spawn;
+
+    for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+        RotationState& state = piece.rotations[rotation];
+        state.blocks = blocks;
+        state.mask = PieceMask{};
+        for (const BlockOffset& block : blocks) {
+            state.mask.rows[block.row] |= static_cast<uint16_t>(1u << block.col);
+        }
+
+        // Clockwise turn with rows growing upwards: (col, row) -> (row, size - 1 - col)
+        for (BlockOffset& block : blocks) {
+            int col = block.col;
+            block.col = block.row;
+            block.row = static_cast<int8_t>(boxSize - 1 - col);
+        }
+    }
+    return piece;
+}
+
+// Spawn states follow the SRS guideline: flat side down, in the upper rows of the box.
+inline constexpr std::array<PieceDefinition, SHAPE_COUNT> PIECES = {{
+    MakePiece(4, {{{2, 0}, {2, 1}, {2, 2}, {2, 3}}}),  // I
+    MakePiece(3, {{{2, 0}, {1, 0}, {1, 1}, {1, 2}}}),  // J
+    MakePiece(3, {{{2, 2}, {1, 0}, {1, 1}, {1, 2}}}),  // L
+    MakePiece(2, {{{0, 0}, {0, 1}, {1, 0}, {1, 1}}}),  // O
+    MakePiece(3, {{{2, 1}, {2, 2}, {1, 0}, {1, 1}}}),  // S
+    MakePiece(3, {{{2, 1}, {1, 0}, {1, 1}, {1, 2}}}),  // T
+    MakePiece(3, {{{2, 0}, {2, 1}, {1, 1}, {1, 2}}}),  // Z
+}};
+
+using KickTable = std::array<std::array<KickOffset, KICK_COUNT>, ROTATION_COUNT>;
+
+// Wall kicks indexed by the rotation being left, for clockwise (from -> from + 1)
+// and counter-clockwise (from -> from - 1) turns. Values are the standard SRS
+// tables with y pointing up.
+inline constexpr KickTable JLSTZ_KICKS_CW = {{
+    {{{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}}},  // 0 -> R
+    {{{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}}},      // R -> 2
+    {{{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}}},     // 2 -> L
+    {{{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}}},   // L -> 0
+}};
+
+inline constexpr KickTable JLSTZ_KICKS_CCW = {{
+    {{{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}}},     // 0 -> L
+    {{{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}}},      // R -> 0
+    {{{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}}},  // 2 -> R
+    {{{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}}},   // L -> 2
+}};
+
+inline constexpr KickTable I_KICKS_CW = {{
+    {{{0, 0}, {-2, 0}, {1, 0}, {-2, -1}, {1, 2}}},  // 0 -> R
+    {{{0, 0}, {-1, 0}, {2, 0}, {-1, 2}, {2, -1}}},  // R -> 2
+    {{{0, 0}, {2, 0}, {-1, 0}, {2, 1}, {-1, -2}}},  // 2 -> L
+    {{{0, 0}, {1, 0}, {-2, 0}, {1, -2}, {-2, 1}}},  // L -> 0
+}};
+
+inline constexpr KickTable I_KICKS_CCW = {{
+    {{{0, 0}, {-1, 0}, {2, 0}, {-1, 2}, {2, -1}}},  // 0 -> L
+    {{{0, 0}, {2, 0}, {-1, 0}, {2, 1}, {-1, -2}}},  // R -> 0
+    {{{0, 0}, {1, 0}, {-2, 0}, {1, -2}, {-2, 1}}},  // 2 -> R
+    {{{0, 0}, {-2, 0}, {1, 0}, {-2, -1}, {1, 2}}},  // L -> 2
+}};
+
+// The O piece never needs to move when it turns.
+inline constexpr KickTable O_KICKS = {};
+
+inline constexpr const PieceDefinition& GetPiece(ShapeType shape) {
+    return PIECES[static_cast<int>(shape)];
+}
+
+inline constexpr const RotationState& GetRotation(ShapeType shape, int rotation) {
+    return PIECES[static_cast<int>(shape)].rotations[rotation];
+}
+
+inline constexpr const std::array<KickOffset, KICK_COUNT>& GetKicks(ShapeType shape, int from, bool clockwise) {
+    if (shape == ShapeType::O) return O_KICKS[from];
+    if (shape == ShapeType::I) return clockwise ? I_KICKS_CW[from] : I_KICKS_CCW[from];
+    return clockwise ? JLSTZ_KICKS_CW[from] : JLSTZ_KICKS_CCW[from];
+}
+
+inline constexpr int NextRotation(int rotation, bool clockwise) {
+    return (rotation + (clockwise ? 1 : ROTATION_COUNT - 1)) % ROTATION_COUNT;
+}
+
+// A few compile-time spot checks of the generated tables
+static_assert(GetRotation(ShapeType::I, 1).mask.rows[0] == 0b0100 && GetRotation(ShapeType::I, 1).mask.rows[3] == 0b0100,
+              "I piece R state must be the vertical bar in column 2");
+static_assert(GetRotation(ShapeType::T, 2).mask.rows[1] == 0b0111 && GetRotation(ShapeType::T, 2).mask.rows[0] == 0b0010,
+              "T piece 180 state must point down");
+static_assert(GetRotation(ShapeType::O, 3).mask.rows[0] == 0b0011 && GetRotation(ShapeType::O, 3).mask.rows[1] == 0b0011,
+              "O piece must not change when rotated");
+
+}  // namespace PieceTables
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Random {
+
+/// One step of SplitMix64. Used to expand a single seed into generator state.
+inline constexpr uint64_t SplitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+}  // namespace Random
+
+/**
+ * @class Xoshiro256
+ * @brief xoshiro256** pseudo random generator.
+ *
+ * Small, fast and fully deterministic for a given seed. Each game owns its own
+ * instance, so nothing is shared between threads.
+ */
+class Xoshiro256 {
+   private:
+    uint64_t m_State[4];
+
+    static inline uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+   public:
+    explicit Xoshiro256(uint64_t seed = 0) { Seed(seed); }
+
+    void Seed(uint64_t seed) {
+        for (uint64_t& word : m_State) word = Random::SplitMix64(seed);
+    }
+
+    uint64_t Next() {
+        uint64_t result = Rotl(m_State[1] * 5, 7) * 9;
+        uint64_t t = m_State[1] << 17;
+
+        m_State[2] ^= m_State[0];
+        m_State[3] ^= m_State[1];
+        m_State[1] ^= m_State[2];
+        m_State[0] ^= m_State[3];
+        m_State[2] ^= t;
+        m_State[3] = Rotl(m_State[3], 45);
+
+        return result;
+    }
+
+    /// @return A value in [0, bound) using a multiply-shift reduction (no division).
+    uint32_t NextBelow(uint32_t bound) {
+        return static_cast<uint32_t>(((Next() >> 32) * bound) >> 32);
+    }
+
+    /**
+     * @brief Advances the generator by 2^128 calls to `Next`.
+     *
+     * Gives non-overlapping streams from one seed.
+     */
+    void Jump();
+};
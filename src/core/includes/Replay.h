@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "Game.h"
+
+/**
+ * @struct ReplayEvent
+ * @brief One recorded step of a game: a player input or a gravity step.
+ *
+ * Gravity is recorded next to the inputs so playback never depends on timing.
+ */
+struct ReplayEvent {
+    static constexpr uint8_t Gravity = 7;  // Code of a gravity step; codes 0..5 are `Input` values.
+
+    uint64_t time = 0;  // Milliseconds since the game started.
+    uint8_t code = 0;
+
+    inline bool IsGravity() const { return code == Gravity; };
+    inline Input GetInput() const { return static_cast<Input>(code); };
+};
+
+/**
+ * Replay files are a small header followed by one varint per event:
+ *
+ *     "TXRP" | version (1 byte) | seed (varint) | events...
+ *
+ * Each event is `(timeDelta << 3) | code`, so an input within a couple of
+ * seconds of the previous one takes two bytes and a burst takes one. There is
+ * no trailer, so a file cut short still plays back up to its last whole event.
+ */
+namespace ReplayFormat {
+
+constexpr char Magic[4] = {'T', 'X', 'R', 'P'};
+constexpr uint8_t Version = 1;
+constexpr int CodeBits = 3;
+
+}  // namespace ReplayFormat
+
+/**
+ * @class ReplayWriter
+ * @brief Appends a game's events to a replay file as they happen.
+ *
+ * Only the file stream's own buffer is held in memory, however long the game.
+ */
+class ReplayWriter {
+   private:
+    std::ofstream m_File;
+    uint64_t m_LastTime = 0;
+
+    void WriteVarint(uint64_t value);
+
+   public:
+    ReplayWriter() = default;
+    ~ReplayWriter();
+
+    /**
+     * @brief Creates (or truncates) `path` and writes the header.
+     *
+     * @return False if the file could not be written.
+     */
+    bool Open(const std::string& path, uint64_t seed);
+    void Close();
+
+    inline bool IsOpen() const { return m_File.is_open(); };
+
+    /// @param event Times must not go backwards; earlier times are clamped to the last one.
+    void Record(const ReplayEvent& event);
+    inline void RecordInput(uint64_t time, Input input) { Record({time, static_cast<uint8_t>(input)}); };
+    inline void RecordGravity(uint64_t time) { Record({time, ReplayEvent::Gravity}); };
+
+    /// Pushes buffered events to disk, e.g. before a crash report.
+    void Flush();
+};
+
+/**
+ * @class ReplayReader
+ * @brief Streams the events of a replay file back, one at a time.
+ */
+class ReplayReader {
+   private:
+    std::ifstream m_File;
+    uint64_t m_Seed = 0;
+    uint64_t m_LastTime = 0;
+    uint64_t m_EventsRead = 0;
+
+    bool ReadVarint(uint64_t& value);
+
+   public:
+    /**
+     * @brief Opens `path` and reads the header.
+     *
+     * @return False if the file is missing, not a replay or of an unknown version.
+     */
+    bool Open(const std::string& path);
+
+    inline uint64_t GetSeed() const { return m_Seed; };
+
+    /**
+     * @brief Reads the next event.
+     *
+     * @return False at the end of the file or at a truncated or corrupt event.
+     */
+    bool Next(ReplayEvent& event);
+
+    /**
+     * @brief Re-simulates the rest of the file as fast as possible.
+     *
+     * Resets `game` to the replay's seed first if no events have been read yet.
+     *
+     * @return The number of events played.
+     */
+    uint64_t Play(Game& game);
+};
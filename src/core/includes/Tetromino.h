@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <utility>
+
+#include "Bitboard.h"
+#include "PieceTables.h"
+
+class Tetromino {
+   private:
+    std::array<std::pair<int, int>, 4> m_BlockPositions{};
+
+    int m_Row = 0, m_Col = 0;  // Bottom-left corner of the piece box.
+    int m_Rotation = 0;        // Index into the piece's rotation table.
+    ShapeType m_Shape = ShapeType::I;
+
+    /// Refreshes the absolute block positions from the rotation table.
+    void UpdateBlocks();
+
+   public:
+    Tetromino() = default;
+
+    void MoveRight();
+    void MoveLeft();
+    void MoveDown();
+
+    /**
+     * @brief Turns the piece one step and applies the wall kick that made it fit.
+     *
+     * The caller is expected to have found the kick with `Grid::FindRotationKick`.
+     */
+    void Rotate(bool clockwise, KickOffset kick);
+
+    void SetShape(int baseRow, int baseCol, ShapeType shape);
+
+    const std::array<std::pair<int, int>, 4>& GetBlockPositions() const { return m_BlockPositions; }
+    inline const PieceMask& GetMask() const { return PieceTables::GetRotation(m_Shape, m_Rotation).mask; };
+    inline int GetRow() const { return m_Row; };
+    inline int GetCol() const { return m_Col; };
+    inline int GetRotation() const { return m_Rotation; };
+    inline ShapeType GetShape() const { return m_Shape; };
+};
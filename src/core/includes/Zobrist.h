@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Random.h"
+
+/*
+Zobrist keys
+Every board cell gets a fixed random 64-bit key and a board hashes to the XOR of
+the keys of its occupied cells. To hash a whole row mask in two lookups, each
+row keeps two 32-entry tables that hold the XOR of every subset of five cells.
+All keys are generated at compile time from a fixed seed, so hashes are the same
+in every process and on every thread.
+*/
+namespace Zobrist {
+
+constexpr int Rows = 32;
+constexpr int Cols = 10;
+constexpr int HalfBits = Cols / 2;
+constexpr int HalfSize = 1 << HalfBits;
+constexpr int LineKeys = 64;
+
+struct Tables {
+    std::array<std::array<std::array<uint64_t, HalfSize>, 2>, Rows> rowHalves;
+    std::array<uint64_t, LineKeys> lines;  // Mixed in by searches that score (board, lines) pairs.
+};
+
+constexpr Tables MakeTables() {
+    Tables tables{};
+    uint64_t state = 0x7E7217ull;
+
+    for (int row = 0; row < Rows; row++) {
+        for (int half = 0; half < 2; half++) {
+            std::array<uint64_t, HalfBits> cellKeys{};
+            for (uint64_t& key : cellKeys) key = Random::SplitMix64(state);
+
+            // Each subset is the previous subset (lowest bit removed) plus that bit's key
+            auto& table = tables.rowHalves[row][half];
+            table[0] = 0;
+            for (int subset = 1; subset < HalfSize; subset++) {
+                int bit = 0;
+                while (!(subset & (1 << bit))) bit++;
+                table[subset] = table[subset & (subset - 1)] ^ cellKeys[bit];
+            }
+        }
+    }
+    for (uint64_t& key : tables.lines) key = Random::SplitMix64(state);
+    return tables;
+}
+
+inline constexpr Tables TABLES = MakeTables();
+
+/**
+ * @param row Board row.
+ * @param cells Occupied columns of the row, bit `c` for column `c` (no wall bits).
+ * @return The XOR of the keys of the given cells.
+ */
+inline constexpr uint64_t RowKey(int row, uint32_t cells) {
+    return TABLES.rowHalves[row][0][cells & (HalfSize - 1)] ^ TABLES.rowHalves[row][1][(cells >> HalfBits) & (HalfSize - 1)];
+}
+
+inline constexpr uint64_t CellKey(int row, int col) {
+    return RowKey(row, 1u << col);
+}
+
+inline constexpr uint64_t LinesKey(int lines) {
+    return TABLES.lines[lines & (LineKeys - 1)];
+}
+
+}  // namespace Zobrist
@@ -1,22 +1,82 @@
 // GLAlgorithms.cpp
 #include "GLAlgorithms.h"
 
-#include <cmath>
-#include <iostream>
-#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 namespace GLAlgorithms {
 
-void DrawLine(int x1, int y1, int x2, int y2, std::vector<float>& vertices) {
+namespace {
+
+/**
+ * Writes `count` points starting at (x, y), each `dx`, `dy` from the last.
+ * Only used with axis-aligned steps, where every point is a constant offset
+ * from the previous one and whole registers of points can be stored at once.
+ */
+void WriteRun(float x, float y, float dx, float dy, size_t count, float* out) {
+    size_t i = 0;
+
+#if defined(__AVX__)
+    // Four points per store: lanes hold x0 y0 x1 y1 x2 y2 x3 y3
+    __m256 points = _mm256_setr_ps(x, y, x + dx, y + dy, x + 2 * dx, y + 2 * dy, x + 3 * dx, y + 3 * dy);
+    const __m256 step = _mm256_setr_ps(4 * dx, 4 * dy, 4 * dx, 4 * dy, 4 * dx, 4 * dy, 4 * dx, 4 * dy);
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_ps(out + 2 * i, points);
+        points = _mm256_add_ps(points, step);
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    // Two points per store: lanes hold x0 y0 x1 y1
+    __m128 points = _mm_setr_ps(x, y, x + dx, y + dy);
+    const __m128 step = _mm_setr_ps(2 * dx, 2 * dy, 2 * dx, 2 * dy);
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_ps(out + 2 * i, points);
+        points = _mm_add_ps(points, step);
+    }
+#endif
+
+    // Tail, or everything without SIMD; coordinates are small integers, so adding is exact
+    for (; i < count; i++) {
+        out[2 * i] = x + dx * static_cast<float>(i);
+        out[2 * i + 1] = y + dy * static_cast<float>(i);
+    }
+}
+
+}  // namespace
+
+size_t LinePointCount(int x1, int y1, int x2, int y2) {
+    return static_cast<size_t>(std::max(std::abs(x2 - x1), std::abs(y2 - y1))) + 1;
+}
+
+size_t RectPointCount(int width, int height) {
+    return width > 0 && height > 0 ? static_cast<size_t>(width) * height : 0;
+}
+
+size_t DrawLine(int x1, int y1, int x2, int y2, float* out, size_t capacity) {
+    size_t count = LinePointCount(x1, y1, x2, y2);
+    if (count > capacity) return 0;
+
     int dx = std::abs(x2 - x1);
     int dy = std::abs(y2 - y1);
     int sx = (x1 < x2) ? 1 : -1;
     int sy = (y1 < y2) ? 1 : -1;
-    int err = dx - dy;
 
-    while (true) {
-        vertices.push_back(static_cast<float>(x1));
-        vertices.push_back(static_cast<float>(y1));
+    if (dy == 0 || dx == 0) {
+        WriteRun(static_cast<float>(x1), static_cast<float>(y1), dy == 0 ? static_cast<float>(sx) : 0.0f,
+                 dx == 0 ? static_cast<float>(sy) : 0.0f, count, out);
+        return count;
+    }
+
+    // Diagonals: Bresenham, one point per step
+    int err = dx - dy;
+    for (size_t i = 0;; i++) {
+        out[2 * i] = static_cast<float>(x1);
+        out[2 * i + 1] = static_cast<float>(y1);
 
         if (x1 == x2 && y1 == y2) break;
         int e2 = 2 * err;
@@ -29,6 +89,38 @@ void DrawLine(int x1, int y1, int x2, int y2, std::vector<float>& vertices) {
             y1 += sy;
         }
     }
+    return count;
+}
+
+size_t FillRect(int x, int y, int width, int height, float* out, size_t capacity) {
+    size_t count = RectPointCount(width, height);
+    if (count == 0 || count > capacity) return 0;
+
+    for (int row = 0; row < height; row++) {
+        WriteRun(static_cast<float>(x), static_cast<float>(y + row), 1.0f, 0.0f, width, out + 2 * static_cast<size_t>(row) * width);
+    }
+    return count;
+}
+
+const float* DrawLine(int x1, int y1, int x2, int y2, FrameArena& arena, size_t& count) {
+    size_t points = LinePointCount(x1, y1, x2, y2);
+    float* out = arena.AllocateArray<float>(2 * points);
+    count = out ? DrawLine(x1, y1, x2, y2, out, points) : 0;
+    return out;
+}
+
+const float* FillRect(int x, int y, int width, int height, FrameArena& arena, size_t& count) {
+    size_t points = RectPointCount(width, height);
+    float* out = points ? arena.AllocateArray<float>(2 * points) : nullptr;
+    count = out ? FillRect(x, y, width, height, out, points) : 0;
+    return out;
+}
+
+void DrawLine(int x1, int y1, int x2, int y2, std::vector<float>& vertices) {
+    size_t first = vertices.size();
+    size_t count = LinePointCount(x1, y1, x2, y2);
+    vertices.resize(first + 2 * count);
+    DrawLine(x1, y1, x2, y2, vertices.data() + first, count);
 }
 
 }  // namespace GLAlgorithms
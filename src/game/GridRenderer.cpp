@@ -0,0 +1,46 @@
+#include "GridRenderer.h"
+
+#include "BoardLayout.h"
+#include "Profiler.h"
+
+namespace {
+
+constexpr Color8 LINE_COLOR = {179, 153, 153, 255};
+constexpr Color8 BLOCK_COLOR = {179, 153, 153, 255};  // Same as the board lines
+constexpr Color8 EMPTY_COLOR = {0, 0, 0, 0};          // Not drawn
+
+}  // namespace
+
+GridRenderer::GridRenderer(const Grid& grid, BatchRenderer& batch) {
+    batch.ResizeRetained(grid.GetCols() * grid.GetRows());
+    m_CellStates.assign(grid.GetCols() * grid.GetRows(), 0);
+
+    Update(grid, batch);
+}
+
+void GridRenderer::Update(const Grid& grid, BatchRenderer& batch) {
+    if (grid.GetRevision() == m_Revision) return;
+    PROFILE_ZONE("Grid update");
+    m_Revision = grid.GetRevision();
+
+    // Rewrite only the slots whose cell changed; a lock touches four, a clear the rows above it
+    int cols = grid.GetCols();
+    for (int row = 0; row < grid.GetRows(); row++) {
+        for (int col = 0; col < cols; col++) {
+            int state = grid.GetCellState(col, row);
+            int& shown = m_CellStates[row * cols + col];
+            if (state == shown) continue;
+
+            shown = state;
+            batch.SetRetained(row * cols + col, {static_cast<float>(BoardLayout::CellX(col)), static_cast<float>(BoardLayout::CellY(row)),
+                                                 BoardLayout::CellWidth, BoardLayout::CellHeight, state ? BLOCK_COLOR : EMPTY_COLOR});
+        }
+    }
+}
+
+void GridRenderer::Submit(const Grid& grid, BatchRenderer& batch) const {
+    batch.Submit(BatchLayer::Background, BatchMaterial::GridLines,
+                 {BoardLayout::StartX, BoardLayout::StartY,
+                  static_cast<float>(grid.GetCols() * BoardLayout::CellWidth),
+                  static_cast<float>(grid.GetRows() * BoardLayout::CellHeight), LINE_COLOR});
+}
@@ -0,0 +1,76 @@
+#include "MemoryOverlay.h"
+
+#include <algorithm>
+
+#include "BoardLayout.h"
+
+namespace {
+
+constexpr float LEFT = BoardLayout::CellX(10) + 18.0f;  // Right of the 10-column board.
+constexpr float WIDTH = 200.0f;
+constexpr float TOP = BoardLayout::WindowHeight - 24.0f;
+constexpr float ROW_HEIGHT = 10.0f;
+constexpr float ROW_STEP = 18.0f;
+
+constexpr unsigned int MAX_ALLOCATION_MARKS = 32;
+constexpr float MARK_WIDTH = WIDTH / MAX_ALLOCATION_MARKS;
+
+constexpr Color8 TRACK_COLOR = {60, 60, 60, 255};
+constexpr Color8 HEAP_COLOR = {80, 200, 120, 255};
+constexpr Color8 ALLOCATION_COLOR = {230, 60, 60, 255};
+
+constexpr Color8 TAG_COLORS[] = {
+    {150, 150, 150, 255},  // GpuMemoryTag::Other
+    {90, 140, 230, 255},   // GpuMemoryTag::Meshes
+    {240, 180, 60, 255},   // GpuMemoryTag::Instances
+    {180, 100, 220, 255},  // GpuMemoryTag::Uniforms
+    {70, 200, 200, 255},   // GpuMemoryTag::Textures
+};
+
+constexpr Color8 LAYER_COLORS[] = {
+    {179, 153, 153, 255},  // BatchLayer::Background, the grid lines
+    {120, 200, 120, 255},  // BatchLayer::Board, the locked blocks
+    {255, 0, 0, 255},      // BatchLayer::Pieces, the active piece
+    {150, 150, 150, 255},  // BatchLayer::Overlay
+};
+
+inline float RowY(int row) {
+    return TOP - row * ROW_STEP - ROW_HEIGHT;
+}
+
+/// Splits one row into segments as wide as each value's share of the total.
+template <typename T>
+void SubmitShares(BatchRenderer& batch, int row, const T* values, const Color8* colors, int count) {
+    double total = 0.0;
+    for (int i = 0; i < count; i++) total += static_cast<double>(values[i]);
+
+    batch.Submit(BatchLayer::Overlay, BatchMaterial::Solid, {LEFT, RowY(row), WIDTH, ROW_HEIGHT, TRACK_COLOR});
+    if (total <= 0.0) return;
+
+    float x = LEFT;
+    for (int i = 0; i < count; i++) {
+        float width = static_cast<float>(WIDTH * (static_cast<double>(values[i]) / total));
+        batch.Submit(BatchLayer::Overlay, BatchMaterial::Solid, {x, RowY(row), width, ROW_HEIGHT, colors[i]});
+        x += width;
+    }
+}
+
+}  // namespace
+
+void MemoryOverlay::Submit(const MemorySnapshot& snapshot, BatchRenderer& batch) {
+    // Heap: live against peak; the track alone when allocations are not counted
+    batch.Submit(BatchLayer::Overlay, BatchMaterial::Solid, {LEFT, RowY(0), WIDTH, ROW_HEIGHT, TRACK_COLOR});
+    if (snapshot.heapPeakBytes > 0) {
+        float live = WIDTH * static_cast<float>(snapshot.heapLiveBytes) / static_cast<float>(snapshot.heapPeakBytes);
+        batch.Submit(BatchLayer::Overlay, BatchMaterial::Solid, {LEFT, RowY(0), live, ROW_HEIGHT, HEAP_COLOR});
+    }
+
+    SubmitShares(batch, 1, snapshot.gpuBytes, TAG_COLORS, static_cast<int>(GpuMemoryTag::Count));
+    SubmitShares(batch, 2, snapshot.layerBytes, LAYER_COLORS, static_cast<int>(BatchLayer::Count));
+
+    unsigned int marks = static_cast<unsigned int>(std::min<uint64_t>(snapshot.frameAllocations, MAX_ALLOCATION_MARKS));
+    for (unsigned int i = 0; i < marks; i++) {
+        batch.Submit(BatchLayer::Overlay, BatchMaterial::Solid,
+                     {LEFT + i * MARK_WIDTH, RowY(3), MARK_WIDTH - 1.0f, ROW_HEIGHT, ALLOCATION_COLOR});
+    }
+}
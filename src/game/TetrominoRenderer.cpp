@@ -0,0 +1,36 @@
+#include "TetrominoRenderer.h"
+
+#include <cstdlib>
+
+#include "BoardLayout.h"
+
+namespace {
+
+constexpr Color8 PIECE_COLOR = {255, 0, 0, 255};
+
+}  // namespace
+
+void TetrominoRenderer::Update(const Tetromino& tetromino) {
+    m_Tetromino = tetromino;
+    m_Offset = glm::vec2(0.0f);
+}
+
+void TetrominoRenderer::Update(const Tetromino& previous, const Tetromino& current, float alpha) {
+    Update(current);
+
+    int deltaRow = previous.GetRow() - current.GetRow();
+    int deltaCol = previous.GetCol() - current.GetCol();
+    bool step = previous.GetShape() == current.GetShape() && previous.GetRotation() == current.GetRotation() &&
+                std::abs(deltaRow) <= 1 && std::abs(deltaCol) <= 1;
+
+    float remaining = step ? 1.0f - alpha : 0.0f;
+    m_Offset = glm::vec2(deltaCol * BoardLayout::CellWidth, deltaRow * BoardLayout::CellHeight) * remaining;
+}
+
+void TetrominoRenderer::Submit(BatchRenderer& batch) const {
+    for (const auto& [row, col] : m_Tetromino.GetBlockPositions()) {  // Unpack into row and col
+        batch.Submit(BatchLayer::Pieces, BatchMaterial::Solid,
+                     {BoardLayout::CellX(col) + m_Offset.x, BoardLayout::CellY(row) + m_Offset.y,
+                      BoardLayout::CellWidth, BoardLayout::CellHeight, PIECE_COLOR});
+    }
+}
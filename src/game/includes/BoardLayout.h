@@ -0,0 +1,28 @@
+#pragma once
+
+/*
+Game Board Info:
+Window      : 683 x 738
+Grid Height : 738 pixels
+Grid Weight : 410 pixels
+Grid Size   : 10 cols x 24 rows
+Cell Size   : 41 x 36 pixels per cell
+Start       : (x, y) -> (28,  3)
+*/
+namespace BoardLayout {
+
+constexpr int WindowWidth = 683;
+constexpr int WindowHeight = 738;
+
+constexpr int CellWidth = 41;
+constexpr int CellHeight = 36;
+constexpr int StartX = 28;
+constexpr int StartY = 3;
+
+/// Pixel x of the left edge of a column.
+inline constexpr int CellX(int col) { return StartX + col * CellWidth; }
+
+/// Pixel y of the bottom edge of a row.
+inline constexpr int CellY(int row) { return StartY + row * CellHeight; }
+
+}  // namespace BoardLayout
@@ -1,9 +1,56 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
+#include "FrameArena.h"
+
+/*
+Point rasterization kernels. Each point is written as two floats (x, y), so a
+buffer for `n` points holds `2 * n` floats. The kernels write into memory the
+caller owns (a reserved vector, a stack array, a mapped GPU buffer or the
+frame's FrameArena) and never touch the heap. Horizontal and vertical lines
+and filled rectangles use SSE2 stores, or AVX ones when built with
+TETRIX_AVX; only diagonal lines step with Bresenham.
+*/
 namespace GLAlgorithms {
 
+/// Points `DrawLine` writes for this line: one per pixel along the longer axis.
+size_t LinePointCount(int x1, int y1, int x2, int y2);
+
+/// Points `FillRect` writes: `width * height`, or 0 for an empty rectangle.
+size_t RectPointCount(int width, int height);
+
+/**
+ * @brief Rasterizes the line from (x1, y1) to (x2, y2), both ends included.
+ *
+ * @param out Receives `LinePointCount` points.
+ * @param capacity Size of `out` in points; nothing is written if it is too small.
+ * @return Points written.
+ */
+size_t DrawLine(int x1, int y1, int x2, int y2, float* out, size_t capacity);
+
+/**
+ * @brief Fills the rectangle with its bottom-left corner at (x, y), row by row from the bottom.
+ *
+ * @param out Receives `RectPointCount` points.
+ * @param capacity Size of `out` in points; nothing is written if it is too small.
+ * @return Points written.
+ */
+size_t FillRect(int x, int y, int width, int height, float* out, size_t capacity);
+
+/**
+ * @brief Rasterizes the line into memory taken from `arena`, valid until the arena is reset.
+ *
+ * @param count Receives the number of points, 0 if the arena is full.
+ * @return The points, or null if the arena is full.
+ */
+const float* DrawLine(int x1, int y1, int x2, int y2, FrameArena& arena, size_t& count);
+
+/// `FillRect` into memory taken from `arena`; see the `DrawLine` overload above.
+const float* FillRect(int x, int y, int width, int height, FrameArena& arena, size_t& count);
+
+/// Appends the line's points to `vertices`, growing it once.
 void DrawLine(int x1, int y1, int x2, int y2, std::vector<float>& vertices);
 
-}  // namespace GLAlgorithms
\ No newline at end of file
+}  // namespace GLAlgorithms
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BatchRenderer.h"
+#include "Grid.h"
+
+/**
+ * @class GridRenderer
+ * @brief Feeds the board lines and the locked blocks of a core `Grid` to a `BatchRenderer`.
+ *
+ * The lines are a single procedural quad. The locked blocks live in the
+ * batch's retained slots, one per board cell, so a lock or line clear only
+ * touches the cells that changed.
+ */
+class GridRenderer {
+   private:
+    std::vector<int> m_CellStates;     // Cell states the retained slots currently show.
+    uint32_t m_Revision = UINT32_MAX;  // Grid revision the blocks were built from.
+
+   public:
+    /**
+     * @brief Claims one retained slot per cell of `grid` in `batch`.
+     */
+    GridRenderer(const Grid& grid, BatchRenderer& batch);
+
+    /**
+     * @brief Refreshes the locked blocks if the grid changed since the last call.
+     *
+     * Only cells whose state changed are rewritten, and only the span of slots
+     * between the first and last of them is uploaded.
+     */
+    void Update(const Grid& grid, BatchRenderer& batch);
+
+    /// Adds the board lines to the current frame.
+    void Submit(const Grid& grid, BatchRenderer& batch) const;
+};
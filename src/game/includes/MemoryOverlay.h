@@ -0,0 +1,20 @@
+#pragma once
+
+#include "BatchRenderer.h"
+#include "MemorySnapshot.h"
+
+/*
+Debug overlay for a MemorySnapshot, drawn as bars right of the board (there is
+no text rendering; exact numbers go to the log line, see
+MemorySnapshot::Format). From the top:
+  heap   live bytes filled against a track the length of the peak
+  gpu    one segment per GpuMemoryTag, sized by its share of GPU bytes
+  batch  one segment per BatchLayer (grid, locked blocks, piece, overlay)
+  allocs one red mark per heap allocation in the last frame, up to 32
+*/
+namespace MemoryOverlay {
+
+/// Adds the overlay's quads to the current frame, in `BatchLayer::Overlay`.
+void Submit(const MemorySnapshot& snapshot, BatchRenderer& batch);
+
+}  // namespace MemoryOverlay
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "BatchRenderer.h"
+#include "Tetromino.h"
+#include "glm/glm.hpp"
+
+/**
+ * @class TetrominoRenderer
+ * @brief Feeds the falling piece of a core `Tetromino` to a `BatchRenderer`.
+ */
+class TetrominoRenderer {
+   private:
+    Tetromino m_Tetromino;     // Piece as of the last Update.
+    glm::vec2 m_Offset{0.0f};  // Interpolation offset in pixels.
+
+   public:
+    void Update(const Tetromino& tetromino);
+
+    /**
+     * @brief Draws the piece `alpha` of the way from its previous tick to its current one.
+     *
+     * Only one-cell steps of an unturned piece are blended; spawns, rotations and
+     * drops snap, since sliding through the board would show cells that never existed.
+     */
+    void Update(const Tetromino& previous, const Tetromino& current, float alpha);
+
+    /// Adds the piece's four blocks to the current frame.
+    void Submit(BatchRenderer& batch) const;
+};
@@ -0,0 +1,118 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#ifdef _DEBUG
+
+namespace {
+
+// Each block starts with a header holding its size, so delete knows how much is freed
+constexpr std::size_t HEADER = alignof(std::max_align_t);
+
+std::atomic<uint64_t> s_Allocations{0};
+std::atomic<int64_t> s_LiveBytes{0};
+std::atomic<int64_t> s_PeakBytes{0};
+
+void* CountedAllocate(std::size_t size) {
+    unsigned char* block = static_cast<unsigned char*>(std::malloc(HEADER + size));
+    if (!block) throw std::bad_alloc();
+    *reinterpret_cast<std::size_t*>(block) = size;
+
+    s_Allocations.fetch_add(1, std::memory_order_relaxed);
+    int64_t live = s_LiveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + size;
+    int64_t peak = s_PeakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !s_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    return block + HEADER;
+}
+
+void CountedFree(void* ptr) {
+    if (!ptr) return;
+    unsigned char* block = static_cast<unsigned char*>(ptr) - HEADER;
+    s_LiveBytes.fetch_sub(static_cast<int64_t>(*reinterpret_cast<std::size_t*>(block)), std::memory_order_relaxed);
+    std::free(block);
+}
+
+}  // namespace
+
+// The nothrow forms forward to these; over-aligned (align_val_t) allocations are not counted
+void* operator new(std::size_t size) {
+    return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return CountedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    CountedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    CountedFree(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    CountedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    CountedFree(ptr);
+}
+
+bool AllocationCounter::IsEnabled() {
+    return true;
+}
+
+uint64_t AllocationCounter::GetAllocations() {
+    return s_Allocations.load(std::memory_order_relaxed);
+}
+
+int64_t AllocationCounter::GetLiveBytes() {
+    return s_LiveBytes.load(std::memory_order_relaxed);
+}
+
+int64_t AllocationCounter::GetPeakBytes() {
+    return s_PeakBytes.load(std::memory_order_relaxed);
+}
+
+#else
+
+bool AllocationCounter::IsEnabled() {
+    return false;
+}
+
+uint64_t AllocationCounter::GetAllocations() {
+    return 0;
+}
+
+int64_t AllocationCounter::GetLiveBytes() {
+    return 0;
+}
+
+int64_t AllocationCounter::GetPeakBytes() {
+    return 0;
+}
+
+#endif
+
+FrameAllocationCheck::FrameAllocationCheck(unsigned int warmupFrames) : m_WarmupFrames(warmupFrames) {}
+
+void FrameAllocationCheck::Begin() {
+    m_Start = AllocationCounter::GetAllocations();
+}
+
+uint64_t FrameAllocationCheck::End() {
+    uint64_t allocations = AllocationCounter::GetAllocations() - m_Start;
+    if (++m_Frames > m_WarmupFrames && allocations > 0) {
+        std::cerr << "Frame " << m_Frames << " made " << allocations
+                  << " heap allocations; steady-state frames should make none" << std::endl;
+        assert(allocations == 0);
+    }
+    return allocations;
+}
@@ -0,0 +1,166 @@
+#include "BatchRenderer.h"
+
+#include <cstring>
+
+#include "Profiler.h"
+
+namespace {
+
+constexpr float QUAD_CORNERS[] = {
+    0.0f, 0.0f,
+    1.0f, 0.0f,
+    1.0f, 1.0f,
+    0.0f, 1.0f,
+};
+constexpr unsigned int QUAD_INDICES[] = {0, 1, 2, 2, 3, 0};
+
+constexpr const char* ZONE_NAMES[] = {
+    "Draw solid",       // BatchMaterial::Solid
+    "Draw grid lines",  // BatchMaterial::GridLines
+};
+
+constexpr const char* SHADER_PATHS[] = {
+    "../resources/shaders/Quad.glsl",       // BatchMaterial::Solid
+    "../resources/shaders/GridLines.glsl",  // BatchMaterial::GridLines
+};
+
+inline uint16_t SortKey(BatchLayer layer, BatchMaterial material) {
+    return static_cast<uint16_t>((static_cast<unsigned int>(layer) << 8) | static_cast<unsigned int>(material));
+}
+
+}  // namespace
+
+BatchRenderer::BatchRenderer(size_t retainedCapacity, size_t streamCapacity, ResourceCache& resources)
+    : m_RetainedCapacity(retainedCapacity), m_StreamCapacity(streamCapacity) {
+    m_Retained.reserve(retainedCapacity);
+    m_Items.reserve(streamCapacity);
+
+    m_QuadVBO = resources.GetVertexBuffer("UnitQuad/vec2", QUAD_CORNERS, sizeof(QUAD_CORNERS), [](VertexBuffer& vb) {
+        vb.Push<float>(2);  // a_Corner
+    });
+    m_VAO.AddBuffer(*m_QuadVBO);
+
+    m_InstanceVBO = std::make_unique<VertexBuffer>(nullptr, (retainedCapacity + streamCapacity) * sizeof(QuadInstance),
+                                                   VertexBufferUsage::Stream, GpuMemoryTag::Instances);
+    m_InstanceVBO->Push<float>(4);          // a_Rect
+    m_InstanceVBO->Push<unsigned char>(4);  // a_Color
+    m_VAO.AddBuffer(*m_InstanceVBO, 1, 1);
+
+    m_IBO = resources.GetIndexBuffer("UnitQuad", QUAD_INDICES, 6);
+
+    for (int i = 0; i < 2; i++) {
+        m_Shaders[i] = resources.GetShader(SHADER_PATHS[i]);
+        m_Shaders[i]->BindUniformBlock(UniformBlock::FRAME_NAME, UniformBlock::FRAME_BINDING);
+    }
+}
+
+void BatchRenderer::ResizeRetained(size_t count) {
+    count = std::min(count, m_RetainedCapacity);
+    m_Retained.assign(count, QuadInstance{0.0f, 0.0f, 0.0f, 0.0f, {0, 0, 0, 0}});
+    MarkDirty(0, count);
+}
+
+void BatchRenderer::SetRetained(size_t index, const QuadInstance& quad) {
+    if (index >= m_Retained.size()) return;
+    m_Retained[index] = quad;
+    MarkDirty(index, index + 1);
+}
+
+void BatchRenderer::MarkDirty(size_t begin, size_t end) {
+    for (DirtyRange& dirty : m_Dirty) {
+        dirty.begin = std::min(dirty.begin, begin);
+        dirty.end = std::max(dirty.end, end);
+    }
+}
+
+void BatchRenderer::Begin() {
+    m_Items.clear();
+}
+
+void BatchRenderer::Submit(BatchLayer layer, BatchMaterial material, const QuadInstance& quad) {
+    if (m_Items.size() >= m_StreamCapacity || quad.color.a == 0) return;
+    m_Items.push_back({SortKey(layer, material), static_cast<uint32_t>(m_Items.size()), quad});
+}
+
+void BatchRenderer::Draw(BatchMaterial material, size_t firstInstance, size_t count) {
+    if (count == 0) return;
+    PROFILE_GPU_ZONE(ZONE_NAMES[static_cast<int>(material)]);
+
+    // Point the instance attributes at this run; GL 3.3 has no base instance
+    m_VAO.AddBuffer(*m_InstanceVBO, 1, 1, m_InstanceVBO->GetStreamOffset() + firstInstance * sizeof(QuadInstance));
+    m_Renderer.DrawInstanced(m_VAO, *m_IBO, *m_Shaders[static_cast<int>(material)], static_cast<unsigned int>(count));
+
+    m_Stats.drawCalls++;
+    m_Stats.instances += static_cast<unsigned int>(count);
+    m_Stats.vertices += static_cast<unsigned int>(count * 4);
+}
+
+size_t BatchRenderer::Upload() {
+    PROFILE_ZONE("Batch upload");
+
+    std::sort(m_Items.begin(), m_Items.end(), [](const Item& a, const Item& b) {
+        return a.key != b.key ? a.key < b.key : a.index < b.index;
+    });
+
+    // Bring this region's retained slots up to date, then write the whole sorted stream behind them
+    QuadInstance* region = static_cast<QuadInstance*>(m_InstanceVBO->MapStream());
+    DirtyRange& dirty = m_Dirty[m_Region];
+    if (dirty.begin < dirty.end) {
+        size_t bytes = (dirty.end - dirty.begin) * sizeof(QuadInstance);
+        std::memcpy(region + dirty.begin, &m_Retained[dirty.begin], bytes);
+        m_Stats.uploadBytes += bytes;
+        dirty = DirtyRange();
+    }
+
+    // Items drawn after the retained quads go right behind them in the buffer, so a
+    // run of solid quads can continue straight on from the board; earlier ones go last
+    const uint16_t retainedKey = SortKey(BatchLayer::Board, BatchMaterial::Solid);
+    size_t split = 0;
+    while (split < m_Items.size() && m_Items[split].key < retainedKey) split++;
+
+    QuadInstance* stream = region + m_RetainedCapacity;
+    for (size_t i = split; i < m_Items.size(); i++) *stream++ = m_Items[i].quad;
+    for (size_t i = 0; i < split; i++) *stream++ = m_Items[i].quad;
+    m_Stats.uploadBytes += m_Items.size() * sizeof(QuadInstance);
+
+    m_Stats.layerBytes[static_cast<int>(BatchLayer::Board)] = m_Retained.size() * sizeof(QuadInstance);
+    for (const Item& item : m_Items) m_Stats.layerBytes[item.key >> 8] += sizeof(QuadInstance);
+    m_InstanceVBO->UnmapStream((m_RetainedCapacity + m_Items.size()) * sizeof(QuadInstance));
+    return split;
+}
+
+void BatchRenderer::End() {
+    PROFILE_ZONE("Batch end");
+    m_Stats = BatchStats();
+    size_t split = Upload();
+
+    // Walk the frame in draw order, merging neighbours in the buffer that share a material
+    BatchMaterial runMaterial = BatchMaterial::Solid;
+    size_t runStart = 0, runEnd = 0;
+
+    auto append = [&](BatchMaterial material, size_t first, size_t count) {
+        if (count == 0) return;
+        if (runEnd > runStart && material == runMaterial && first == runEnd) {
+            runEnd += count;
+            return;
+        }
+        Draw(runMaterial, runStart, runEnd - runStart);
+        runMaterial = material;
+        runStart = first;
+        runEnd = first + count;
+    };
+
+    size_t after = m_Items.size() - split;
+    for (size_t i = 0; i < m_Items.size(); i++) {
+        if (i == split) append(BatchMaterial::Solid, 0, m_Retained.size());
+
+        auto material = static_cast<BatchMaterial>(m_Items[i].key & 0xFF);
+        size_t slot = i >= split ? i - split : after + i;
+        append(material, m_RetainedCapacity + slot, 1);
+    }
+    if (split == m_Items.size()) append(BatchMaterial::Solid, 0, m_Retained.size());
+    Draw(runMaterial, runStart, runEnd - runStart);
+
+    m_InstanceVBO->FenceStream();
+    m_Region = (m_Region + 1) % m_InstanceVBO->GetStreamRegions();
+}
@@ -0,0 +1,23 @@
+#include "FrameArena.h"
+
+#include <algorithm>
+
+FrameArena::FrameArena(size_t capacity)
+    : m_Buffer(new unsigned char[capacity]), m_Capacity(capacity) {}
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+    uintptr_t base = reinterpret_cast<uintptr_t>(m_Buffer.get());
+    size_t start = ((base + m_Offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base;
+    if (start + size > m_Capacity) {
+        m_Overflows++;
+        return nullptr;
+    }
+
+    m_Offset = start + size;
+    m_HighWater = std::max(m_HighWater, m_Offset);
+    return m_Buffer.get() + start;
+}
+
+void FrameArena::Reset() {
+    m_Offset = 0;
+}
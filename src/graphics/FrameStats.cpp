@@ -0,0 +1,169 @@
+#include "FrameStats.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace {
+
+constexpr int PHASE_COUNT = static_cast<int>(FramePhase::Count);
+constexpr float BASELINE_WEIGHT = 0.05f;  // Share of each smooth frame in the phase averages.
+constexpr double MIN_OTHER_MS = 0.001;    // Below this, `Other` is rounding left over from the phases.
+
+static_assert(std::atomic<float>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free,
+              "The frame ring must not take locks");
+
+constexpr const char* PHASE_NAMES[PHASE_COUNT] = {
+    "sim",     // FramePhase::Sim
+    "render",  // FramePhase::Render
+    "swap",    // FramePhase::Swap
+    "other",   // FramePhase::Other
+};
+
+/// Value at `fraction` of the way through `values` once sorted; reorders `values`.
+double Percentile(float* values, size_t count, double fraction) {
+    if (count == 0) return 0.0;
+    size_t rank = std::min(static_cast<size_t>(fraction * (count - 1) + 0.5), count - 1);
+    std::nth_element(values, values + rank, values + count);
+    return values[rank];
+}
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+    size_t power = 1;
+    while (power < value) power <<= 1;
+    return power;
+}
+
+}  // namespace
+
+const char* GetFramePhaseName(FramePhase phase) {
+    return PHASE_NAMES[static_cast<int>(phase)];
+}
+
+FrameStats::FrameStats(double budgetMs, size_t capacity)
+    : m_Capacity(RoundUpToPowerOfTwo(std::max(capacity, WINDOW))),
+      m_BudgetMs(budgetMs),
+      m_Scratch(new FrameSample[WINDOW]),
+      m_Totals(new float[WINDOW]) {
+    m_Slots.reset(new Slot[m_Capacity]);
+}
+
+FrameSample FrameStats::Record(double simMs, double renderMs, double swapMs, double totalMs) {
+    uint64_t index = m_Count.load(std::memory_order_relaxed);
+
+    FrameSample sample;
+    sample.frame = index;
+    sample.total = static_cast<float>(totalMs);
+    sample.phases[static_cast<int>(FramePhase::Sim)] = static_cast<float>(simMs);
+    sample.phases[static_cast<int>(FramePhase::Render)] = static_cast<float>(renderMs);
+    sample.phases[static_cast<int>(FramePhase::Swap)] = static_cast<float>(swapMs);
+    double otherMs = totalMs - simMs - renderMs - swapMs;
+    sample.phases[static_cast<int>(FramePhase::Other)] = otherMs > MIN_OTHER_MS ? static_cast<float>(otherMs) : 0.0f;
+    sample.jank = index > 0 && totalMs > JANK_FACTOR * m_BudgetMs;  // The first frame pays for startup
+    sample.cause = FramePhase::Other;
+
+    if (sample.jank) {
+        float worst = -1.0f;
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            float excess = sample.phases[phase] - m_Baseline[phase];
+            if (excess > worst) {
+                worst = excess;
+                sample.cause = static_cast<FramePhase>(phase);
+            }
+        }
+        std::atomic<uint64_t>& janks = m_Janks[static_cast<int>(sample.cause)];
+        janks.store(janks.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    } else if (index <= 1) {
+        std::copy(sample.phases, sample.phases + PHASE_COUNT, m_Baseline);
+    } else {
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            m_Baseline[phase] += BASELINE_WEIGHT * (sample.phases[phase] - m_Baseline[phase]);
+        }
+    }
+
+    // Odd sequence while the fields change; the fence keeps the field stores after it
+    Slot& slot = m_Slots[index & (m_Capacity - 1)];
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.total.store(sample.total, std::memory_order_relaxed);
+    for (int phase = 0; phase < PHASE_COUNT; phase++) slot.phases[phase].store(sample.phases[phase], std::memory_order_relaxed);
+    slot.jank.store(sample.jank, std::memory_order_relaxed);
+    slot.cause.store(sample.cause, std::memory_order_relaxed);
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+
+    m_Count.store(index + 1, std::memory_order_release);
+    return sample;
+}
+
+size_t FrameStats::CopyRecent(FrameSample* out, size_t count) const {
+    uint64_t end = m_Count.load(std::memory_order_acquire);
+    uint64_t begin = end - std::min<uint64_t>({end, count, m_Capacity});
+
+    size_t copied = 0;
+    for (uint64_t frame = begin; frame < end; frame++) {
+        const Slot& slot = m_Slots[frame & (m_Capacity - 1)];
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != 2 * frame + 2) continue;  // Already being overwritten by a later frame
+
+        FrameSample& sample = out[copied];
+        sample.frame = frame;
+        sample.total = slot.total.load(std::memory_order_relaxed);
+        for (int phase = 0; phase < PHASE_COUNT; phase++) sample.phases[phase] = slot.phases[phase].load(std::memory_order_relaxed);
+        sample.jank = slot.jank.load(std::memory_order_relaxed);
+        sample.cause = slot.cause.load(std::memory_order_relaxed);
+
+        // The fence keeps the field loads before the re-check; a changed sequence means a torn copy
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == sequence) copied++;
+    }
+    return copied;
+}
+
+FrameTimeSummary FrameStats::Summarize() {
+    FrameTimeSummary summary;
+    summary.frames = CopyRecent(m_Scratch.get(), WINDOW);
+    for (size_t i = 0; i < summary.frames; i++) {
+        m_Totals[i] = m_Scratch[i].total;
+        summary.max = std::max(summary.max, static_cast<double>(m_Scratch[i].total));
+        summary.janks += m_Scratch[i].jank;
+    }
+
+    summary.p50 = Percentile(m_Totals.get(), summary.frames, 0.50);
+    summary.p95 = Percentile(m_Totals.get(), summary.frames, 0.95);
+    summary.p99 = Percentile(m_Totals.get(), summary.frames, 0.99);
+    return summary;
+}
+
+void FrameStats::PrintSummary(std::ostream& out) {
+    FrameTimeSummary summary = Summarize();
+    out << std::fixed << std::setprecision(2) << "Frame ms (last " << summary.frames << "): p50 " << summary.p50 << ", p95 "
+        << summary.p95 << ", p99 " << summary.p99 << ", max " << summary.max << "\n"
+        << "Janks (> " << JANK_FACTOR * m_BudgetMs << " ms): " << GetJanks() << " of " << GetFrames() << " frames";
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+        out << (phase ? ", " : " (") << PHASE_NAMES[phase] << ' ' << GetJanks(static_cast<FramePhase>(phase));
+    }
+    out << ")" << std::defaultfloat << std::endl;
+}
+
+bool FrameStats::WriteCsv(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) return false;
+
+    std::unique_ptr<FrameSample[]> samples(new FrameSample[m_Capacity]);
+    size_t count = CopyRecent(samples.get(), m_Capacity);
+
+    file << "frame,total_ms,sim_ms,render_ms,swap_ms,other_ms,jank,cause\n";
+    for (size_t i = 0; i < count; i++) {
+        const FrameSample& sample = samples[i];
+        file << sample.frame << ',' << sample.total;
+        for (float phase : sample.phases) file << ',' << phase;
+        file << ',' << sample.jank << ',' << (sample.jank ? GetFramePhaseName(sample.cause) : "") << '\n';
+    }
+    return static_cast<bool>(file);
+}
+
+uint64_t FrameStats::GetJanks() const {
+    uint64_t janks = 0;
+    for (const std::atomic<uint64_t>& count : m_Janks) janks += count.load(std::memory_order_relaxed);
+    return janks;
+}
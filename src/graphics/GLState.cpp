@@ -0,0 +1,133 @@
+#include "GLState.h"
+
+namespace {
+
+constexpr GLuint UNKNOWN = ~0u;  // Never a GL name, so the next bind always goes through.
+constexpr float UNKNOWN_POINT_SIZE = -1.0f;
+
+enum BufferSlot { ARRAY, ELEMENT_ARRAY, UNIFORM, BUFFER_SLOTS };
+
+struct Shadow {
+    GLuint program = UNKNOWN;
+    GLuint vertexArray = UNKNOWN;
+    GLuint buffers[BUFFER_SLOTS] = {UNKNOWN, UNKNOWN, UNKNOWN};
+    unsigned int activeUnit = UNKNOWN;
+    GLuint textures[GLState::MAX_TEXTURE_UNITS];
+    float pointSize = UNKNOWN_POINT_SIZE;
+
+    Shadow() {
+        for (GLuint& texture : textures) texture = UNKNOWN;
+    }
+};
+
+Shadow s_Shadow;
+GLStateStats s_Stats;
+
+int SlotOf(GLenum target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER:
+            return ARRAY;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            return ELEMENT_ARRAY;
+        case GL_UNIFORM_BUFFER:
+            return UNIFORM;
+    }
+    return -1;
+}
+
+/// Updates `current` and returns true if the call has to reach the driver.
+template <typename T>
+bool Changes(T& current, T wanted) {
+    if (current == wanted) {
+        s_Stats.skipped++;
+        return false;
+    }
+    current = wanted;
+    s_Stats.issued++;
+    return true;
+}
+
+}  // namespace
+
+void GLState::UseProgram(GLuint program) {
+    if (Changes(s_Shadow.program, program)) glUseProgram(program);
+}
+
+void GLState::BindVertexArray(GLuint vertexArray) {
+    if (Changes(s_Shadow.vertexArray, vertexArray)) {
+        glBindVertexArray(vertexArray);
+        s_Shadow.buffers[ELEMENT_ARRAY] = UNKNOWN;  // Part of the VAO's state.
+    }
+}
+
+void GLState::BindBuffer(GLenum target, GLuint buffer) {
+    int slot = SlotOf(target);
+    if (slot < 0) {
+        s_Stats.issued++;
+        glBindBuffer(target, buffer);
+        return;
+    }
+    if (Changes(s_Shadow.buffers[slot], buffer)) glBindBuffer(target, buffer);
+}
+
+void GLState::BindTexture(unsigned int unit, GLuint texture) {
+    if (unit >= MAX_TEXTURE_UNITS) {
+        s_Stats.issued += 2;
+        s_Shadow.activeUnit = unit;
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        return;
+    }
+    if (s_Shadow.textures[unit] == texture) {
+        s_Stats.skipped++;
+        return;
+    }
+    if (Changes(s_Shadow.activeUnit, unit)) glActiveTexture(GL_TEXTURE0 + unit);
+    s_Shadow.textures[unit] = texture;
+    s_Stats.issued++;
+    glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+void GLState::PointSize(float size) {
+    if (Changes(s_Shadow.pointSize, size)) glPointSize(size);
+}
+
+void GLState::CountSkipped(unsigned int calls) {
+    s_Stats.skipped += calls;
+}
+
+void GLState::CountIssued(unsigned int calls) {
+    s_Stats.issued += calls;
+}
+
+void GLState::OnDeleteProgram(GLuint program) {
+    if (s_Shadow.program == program) s_Shadow.program = UNKNOWN;
+}
+
+void GLState::OnDeleteVertexArray(GLuint vertexArray) {
+    if (s_Shadow.vertexArray == vertexArray) s_Shadow.vertexArray = 0;
+}
+
+void GLState::OnDeleteBuffer(GLuint buffer) {
+    for (GLuint& bound : s_Shadow.buffers) {
+        if (bound == buffer) bound = 0;
+    }
+}
+
+void GLState::OnDeleteTexture(GLuint texture) {
+    for (GLuint& bound : s_Shadow.textures) {
+        if (bound == texture) bound = 0;
+    }
+}
+
+void GLState::Invalidate() {
+    s_Shadow = Shadow();
+}
+
+const GLStateStats& GLState::GetStats() {
+    return s_Stats;
+}
+
+void GLState::ResetStats() {
+    s_Stats = GLStateStats();
+}
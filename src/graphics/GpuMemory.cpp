@@ -0,0 +1,36 @@
+#include "GpuMemory.h"
+
+namespace {
+
+constexpr int TAG_COUNT = static_cast<int>(GpuMemoryTag::Count);
+
+constexpr const char* TAG_NAMES[TAG_COUNT] = {
+    "other",      // GpuMemoryTag::Other
+    "meshes",     // GpuMemoryTag::Meshes
+    "instances",  // GpuMemoryTag::Instances
+    "uniforms",   // GpuMemoryTag::Uniforms
+    "textures",   // GpuMemoryTag::Textures
+};
+
+// GL objects are only created and deleted on the context's thread
+int64_t s_Bytes[TAG_COUNT] = {};
+
+}  // namespace
+
+void GpuMemory::Add(GpuMemoryTag tag, int64_t bytes) {
+    s_Bytes[static_cast<int>(tag)] += bytes;
+}
+
+int64_t GpuMemory::GetBytes(GpuMemoryTag tag) {
+    return s_Bytes[static_cast<int>(tag)];
+}
+
+int64_t GpuMemory::GetTotalBytes() {
+    int64_t total = 0;
+    for (int64_t bytes : s_Bytes) total += bytes;
+    return total;
+}
+
+const char* GpuMemory::GetTagName(GpuMemoryTag tag) {
+    return TAG_NAMES[static_cast<int>(tag)];
+}
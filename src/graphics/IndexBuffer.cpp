@@ -1,19 +1,24 @@
 #include "IndexBuffer.h"
 
-IndexBuffer::IndexBuffer(const void* data, unsigned int count) : m_Count(count) {
+#include "GLState.h"
+
+IndexBuffer::IndexBuffer(const void* data, unsigned int count, GpuMemoryTag tag) : m_Count(count), m_Tag(tag) {
     glGenBuffers(1, &m_RendererID);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+    Bind();
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(GLuint), data, GL_STATIC_DRAW);  // GLuint == unsigned int
+    GpuMemory::Add(m_Tag, count * sizeof(GLuint));
 }
 
 IndexBuffer::~IndexBuffer() {
+    GLState::OnDeleteBuffer(m_RendererID);
     glDeleteBuffers(1, &m_RendererID);
+    GpuMemory::Add(m_Tag, -static_cast<int64_t>(m_Count * sizeof(GLuint)));
 }
 
 void IndexBuffer::Bind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+    GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
 }
 
 void IndexBuffer::Unbind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    GLState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "MemorySnapshot.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "AllocationCounter.h"
+
+namespace {
+
+constexpr double KIB = 1024.0;
+
+constexpr const char* LAYER_NAMES[] = {
+    "grid",     // BatchLayer::Background
+    "locked",   // BatchLayer::Board
+    "piece",    // BatchLayer::Pieces
+    "overlay",  // BatchLayer::Overlay
+};
+
+/// `snprintf` behind the `length` characters already written; `length` keeps counting past `size` like `snprintf`.
+template <typename... Args>
+void Append(char* out, size_t size, int& length, const char* format, Args... args) {
+    size_t used = std::min(static_cast<size_t>(length), size);
+    length += std::snprintf(out + used, size - used, format, args...);
+}
+
+}  // namespace
+
+MemorySnapshot MemorySnapshot::Take(uint64_t frameAllocations, const BatchStats& batch) {
+    MemorySnapshot snapshot;
+    snapshot.frameAllocations = frameAllocations;
+    snapshot.heapLiveBytes = AllocationCounter::GetLiveBytes();
+    snapshot.heapPeakBytes = AllocationCounter::GetPeakBytes();
+    for (int tag = 0; tag < static_cast<int>(GpuMemoryTag::Count); tag++) {
+        snapshot.gpuBytes[tag] = GpuMemory::GetBytes(static_cast<GpuMemoryTag>(tag));
+    }
+    for (int layer = 0; layer < static_cast<int>(BatchLayer::Count); layer++) {
+        snapshot.layerBytes[layer] = batch.layerBytes[layer];
+    }
+    return snapshot;
+}
+
+int MemorySnapshot::Format(char* out, size_t size) const {
+    int64_t gpuTotal = 0;
+    for (int64_t bytes : gpuBytes) gpuTotal += bytes;
+
+    // heap 812.4 KiB live, 2301.7 KiB peak, 0 allocs/frame | gpu 15.5 KiB: meshes 0.1 ... | batch KiB: grid 0.0 ...
+    int length = 0;
+    Append(out, size, length, "heap %.1f KiB live, %.1f KiB peak, %llu allocs/frame | gpu %.1f KiB:", heapLiveBytes / KIB,
+           heapPeakBytes / KIB, static_cast<unsigned long long>(frameAllocations), gpuTotal / KIB);
+    for (int tag = 0; tag < static_cast<int>(GpuMemoryTag::Count); tag++) {
+        Append(out, size, length, " %s %.1f", GpuMemory::GetTagName(static_cast<GpuMemoryTag>(tag)), gpuBytes[tag] / KIB);
+    }
+    Append(out, size, length, " | batch KiB:");
+    for (int layer = 0; layer < static_cast<int>(BatchLayer::Count); layer++) {
+        Append(out, size, length, " %s %.1f", LAYER_NAMES[layer], layerBytes[layer] / KIB);
+    }
+    return length;
+}
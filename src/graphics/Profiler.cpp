@@ -0,0 +1,242 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <unordered_map>
+
+namespace {
+
+constexpr double NS_PER_MS = 1e6;
+
+struct RollingWindow {
+    double samples[Profiler::WINDOW] = {};
+    unsigned int count = 0;
+    unsigned int next = 0;
+
+    void Push(double value) {
+        samples[next] = value;
+        next = (next + 1) % Profiler::WINDOW;
+        count = std::min(count + 1, Profiler::WINDOW);
+    }
+
+    double Mean() const {
+        double sum = 0.0;
+        for (unsigned int i = 0; i < count; i++) sum += samples[i];
+        return count ? sum / count : 0.0;
+    }
+
+    double Max() const {
+        double max = 0.0;
+        for (unsigned int i = 0; i < count; i++) max = std::max(max, samples[i]);
+        return max;
+    }
+};
+
+struct Zone {
+    const char* name;
+    bool hasGpu = false;
+    unsigned int frameCalls = 0;  // Entries in the open frame.
+    uint64_t frameCpu = 0;        // Nanoseconds in the open frame.
+    RollingWindow calls, cpu, gpu;
+};
+
+struct QueryFrame {
+    GLuint queries[Profiler::MAX_GPU_ZONES] = {};
+    size_t zones[Profiler::MAX_GPU_ZONES] = {};
+    uint64_t cpuBegin[Profiler::MAX_GPU_ZONES] = {};  // Where the trace puts each GPU zone.
+    unsigned int used = 0;
+};
+
+struct TraceEvent {
+    const char* name;
+    uint64_t begin;
+    uint64_t duration;
+    bool gpu;
+};
+
+struct State {
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+    std::vector<Zone> zones;
+    std::unordered_map<const char*, size_t> zoneIndex;  // Every pointer a zone's name has been seen at.
+    std::vector<uint64_t> gpuTotals;  // Per-zone scratch for CollectQueries; kept so frames do not allocate.
+
+    QueryFrame queryFrames[Profiler::QUERY_FRAMES];
+    bool queriesCreated = false;
+    unsigned int queryFrame = 0;  // Slot of the open frame.
+    int activeTicket = -1;        // GPU zone with a query running.
+
+    bool frameOpen = false;
+    uint64_t frameBegin = 0;
+
+    bool capturing = false;
+    size_t maxEvents = 0;
+    std::vector<TraceEvent> events;
+};
+
+State& GetState() {
+    static State state;
+    return state;
+}
+
+size_t ZoneOf(State& state, const char* name) {
+    auto it = state.zoneIndex.find(name);
+    if (it != state.zoneIndex.end()) return it->second;
+
+    // Equal literals in different translation units need not share an address, so match by content
+    size_t zone = 0;
+    while (zone < state.zones.size() && std::strcmp(state.zones[zone].name, name) != 0) zone++;
+    if (zone == state.zones.size()) {
+        state.zones.push_back(Zone());
+        state.zones.back().name = name;
+    }
+    state.zoneIndex[name] = zone;
+    return zone;
+}
+
+void Capture(State& state, const char* name, uint64_t begin, uint64_t duration, bool gpu) {
+    if (state.capturing && state.events.size() < state.maxEvents) state.events.push_back({name, begin, duration, gpu});
+}
+
+/// Reads a finished frame of queries into the statistics; drops it if the GPU is not done yet.
+void CollectQueries(State& state, QueryFrame& frame) {
+    if (frame.used == 0) return;
+
+    // Queries finish in order, so the last one being ready means all are
+    GLint available = 0;
+    glGetQueryObjectiv(frame.queries[frame.used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available) {
+        std::vector<uint64_t>& totals = state.gpuTotals;
+        totals.assign(state.zones.size(), 0);
+        for (unsigned int i = 0; i < frame.used; i++) {
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &elapsed);
+            totals[frame.zones[i]] += elapsed;
+            Capture(state, state.zones[frame.zones[i]].name, frame.cpuBegin[i], elapsed, true);
+        }
+        for (size_t z = 0; z < state.zones.size(); z++) {
+            if (state.zones[z].hasGpu) state.zones[z].gpu.Push(totals[z] / NS_PER_MS);
+        }
+    }
+    frame.used = 0;
+}
+
+}  // namespace
+
+void Profiler::BeginFrame() {
+    State& state = GetState();
+    uint64_t now = Now();
+
+    if (state.frameOpen) {
+        for (Zone& zone : state.zones) {
+            zone.calls.Push(zone.frameCalls);
+            zone.cpu.Push(zone.frameCpu / NS_PER_MS);
+            zone.frameCalls = 0;
+            zone.frameCpu = 0;
+        }
+        Capture(state, "Frame", state.frameBegin, now - state.frameBegin, false);
+    }
+
+    if (!state.queriesCreated) {
+        for (QueryFrame& frame : state.queryFrames) glGenQueries(MAX_GPU_ZONES, frame.queries);
+        state.queriesCreated = true;
+    }
+
+    // The slot about to be reused was filled QUERY_FRAMES - 1 frames ago
+    state.queryFrame = (state.queryFrame + 1) % QUERY_FRAMES;
+    CollectQueries(state, state.queryFrames[state.queryFrame]);
+
+    state.frameOpen = true;
+    state.frameBegin = now;
+}
+
+uint64_t Profiler::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - GetState().epoch).count();
+}
+
+void Profiler::RecordCpu(const char* name, uint64_t begin, uint64_t end) {
+    State& state = GetState();
+    Zone& zone = state.zones[ZoneOf(state, name)];
+    zone.frameCalls++;
+    zone.frameCpu += end - begin;
+    Capture(state, name, begin, end - begin, false);
+}
+
+int Profiler::BeginGpu(const char* name, uint64_t cpuBegin) {
+    State& state = GetState();
+    QueryFrame& frame = state.queryFrames[state.queryFrame];
+    if (!state.queriesCreated || state.activeTicket >= 0 || frame.used == MAX_GPU_ZONES) return -1;
+
+    size_t zone = ZoneOf(state, name);
+    state.zones[zone].hasGpu = true;
+
+    int ticket = static_cast<int>(frame.used++);
+    frame.zones[ticket] = zone;
+    frame.cpuBegin[ticket] = cpuBegin;
+    glBeginQuery(GL_TIME_ELAPSED, frame.queries[ticket]);
+    state.activeTicket = ticket;
+    return ticket;
+}
+
+void Profiler::EndGpu(int ticket) {
+    State& state = GetState();
+    if (ticket < 0 || ticket != state.activeTicket) return;
+
+    glEndQuery(GL_TIME_ELAPSED);
+    state.activeTicket = -1;
+}
+
+void Profiler::StartCapture(size_t maxEvents) {
+    State& state = GetState();
+    state.capturing = true;
+    state.maxEvents = maxEvents;
+    state.events.clear();
+    // Reserved in full so capturing never allocates mid-frame; untouched pages cost no memory
+    state.events.reserve(maxEvents);
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path) {
+    State& state = GetState();
+    std::ofstream file(path);
+    if (!file) return false;
+
+    // Times in microseconds; tid 1 is the CPU, tid 2 the GPU
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+         << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n"
+         << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU (GL_TIME_ELAPSED)\"}}";
+    file << std::fixed << std::setprecision(3);
+    for (const TraceEvent& event : state.events) {
+        file << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"" << (event.gpu ? "gpu" : "cpu")
+             << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << (event.gpu ? 2 : 1) << ",\"ts\":" << event.begin / 1000.0
+             << ",\"dur\":" << event.duration / 1000.0 << "}";
+    }
+    file << "\n]}\n";
+    return static_cast<bool>(file);
+}
+
+std::vector<ProfileZoneStats> Profiler::GetStats() {
+    std::vector<ProfileZoneStats> stats;
+    for (const Zone& zone : GetState().zones) {
+        stats.push_back({zone.name, zone.calls.Mean(), zone.cpu.Mean(), zone.cpu.Max(), zone.gpu.Mean(), zone.gpu.Max()});
+    }
+    return stats;
+}
+
+void Profiler::PrintStats(std::ostream& out) {
+    std::vector<ProfileZoneStats> stats = GetStats();
+    std::sort(stats.begin(), stats.end(), [](const ProfileZoneStats& a, const ProfileZoneStats& b) {
+        return a.cpuMean > b.cpuMean;
+    });
+
+    out << "Zone                  calls  cpu ms (max)       gpu ms (max)    last " << WINDOW << " frames\n";
+    out << std::fixed << std::setprecision(3);
+    for (const ProfileZoneStats& zone : stats) {
+        out << std::left << std::setw(20) << zone.name << std::right << std::setw(7) << std::setprecision(1)
+            << zone.calls << std::setprecision(3) << std::setw(9) << zone.cpuMean << " (" << std::setw(7)
+            << zone.cpuMax << ")" << std::setw(9) << zone.gpuMean << " (" << std::setw(7) << zone.gpuMax << ")\n";
+    }
+    out << std::defaultfloat;
+}
@@ -2,21 +2,38 @@
 
 #include <iostream>
 
+#include "GLState.h"
+#include "Profiler.h"
+
 void Renderer::ClearScreen() const {
+    PROFILE_GPU_ZONE("Clear");
     glClear(GL_COLOR_BUFFER_BIT);
 }
 
 void Renderer::DrawPoints(const unsigned int& start, const VertexArray& va, const Shader& shader, const float& pointSize) const {
+    PROFILE_GPU_ZONE("Draw points");
     shader.Bind();
     va.Bind();
-    glPointSize(pointSize);
+    GLState::PointSize(pointSize);
     glDrawArrays(GL_POINTS, start, va.GetNumVertices());
 }
 
 void Renderer::DrawTringles(const VertexArray& va, const IndexBuffer& ib, const Shader& shader) const {
+    PROFILE_GPU_ZONE("Draw triangles");
     shader.Bind();
     va.Bind();
     ib.Bind();
 
     glDrawElements(GL_TRIANGLES, ib.getCount(), GL_UNSIGNED_INT, nullptr);
 }
+
+void Renderer::DrawInstanced(const VertexArray& va, const IndexBuffer& ib, const Shader& shader, unsigned int instanceCount) const {
+    if (instanceCount == 0) return;
+    PROFILE_GPU_ZONE("Draw instanced");
+
+    shader.Bind();
+    va.Bind();
+    ib.Bind();
+
+    glDrawElementsInstanced(GL_TRIANGLES, ib.getCount(), GL_UNSIGNED_INT, nullptr, instanceCount);
+}
@@ -0,0 +1,23 @@
+#include "ResourceCache.h"
+
+std::shared_ptr<Shader> ResourceCache::GetShader(const std::string& path) {
+    return m_Shaders.Acquire(path, [&]() { return std::make_shared<Shader>(path); });
+}
+
+std::shared_ptr<IndexBuffer> ResourceCache::GetIndexBuffer(const std::string& name, const unsigned int* data, unsigned int count) {
+    return m_IndexBuffers.Acquire(name, [&]() { return std::make_shared<IndexBuffer>(data, count, GpuMemoryTag::Meshes); });
+}
+
+void ResourceCache::Collect() {
+    m_Shaders.Collect();
+    m_VertexBuffers.Collect();
+    m_IndexBuffers.Collect();
+}
+
+unsigned int ResourceCache::GetLoads() const {
+    return m_Shaders.GetLoads() + m_VertexBuffers.GetLoads() + m_IndexBuffers.GetLoads();
+}
+
+unsigned int ResourceCache::GetHits() const {
+    return m_Shaders.GetHits() + m_VertexBuffers.GetHits() + m_IndexBuffers.GetHits();
+}
@@ -1,55 +1,22 @@
 #include "Shader.h"
 
-#include <fstream>
 #include <iostream>
-#include <sstream>
 #include <string>
 
+#include "GLState.h"
+
 Shader::Shader(const std::string& filepath)
     : m_FilePath(filepath), m_RendererID(0) {
-    ShaderProgramSource source = ParseShader(filepath);
+    ShaderProgramSource source = ShaderSource::Load(filepath);
     m_RendererID = CreateShader(source.VertexSource, source.FragmentSource);
+    ResolveUniforms();
 }
 
 Shader::~Shader() {
+    GLState::OnDeleteProgram(m_RendererID);
     glDeleteProgram(m_RendererID);
 }
 
-ShaderProgramSource Shader::ParseShader(const std::string& file) {
-    // Please pass path relative to this file not the main application file (!)
-    std::ifstream stream(file);
-
-    enum class ShaderType {
-        NONE = -1,
-        VERTEX = 0,
-        FRAGMENT = 1
-    };
-
-    ShaderType type = ShaderType::NONE;
-    std::stringstream ss[2];
-    std::string line;
-
-    while (getline(stream, line)) {
-        if (line.find("# shader") != std::string::npos) {
-            if (line.find("vertex") != std::string::npos) {
-                type = ShaderType::VERTEX;
-            } else if (line.find("fragment") != std::string::npos) {
-                type = ShaderType::FRAGMENT;
-            }
-        } else {
-            ss[(int)type] << line << '\n';
-        }
-    }
-
-    // // For DEBUG & Testing
-    // std::cout << "START" << std::endl;
-    // std::cout << ss[0].str() << std::endl;
-    // std::cout << ss[1].str() << std::endl;
-    // std::cout << "END" << std::endl;
-
-    return {ss[0].str(), ss[1].str()};
-}
-
 unsigned int Shader::CompileShader(unsigned int type, const std::string& source) {
     unsigned int id = glCreateShader(type);
     const char* src = source.c_str();
@@ -95,28 +62,90 @@ unsigned int Shader::CreateShader(const std::string& vertexShader, const std::st
 }
 
 void Shader::Bind() const {
-    glUseProgram(m_RendererID);
+    GLState::UseProgram(m_RendererID);
 }
 
 void Shader::Unbind() const {
-    glUseProgram(0);
+    GLState::UseProgram(0);
+}
+
+bool Shader::BindUniformBlock(const std::string& name, unsigned int bindingPoint) {
+    unsigned int index = glGetUniformBlockIndex(m_RendererID, name.c_str());
+    if (index == GL_INVALID_INDEX) return false;
+
+    glUniformBlockBinding(m_RendererID, index, bindingPoint);
+    return true;
 }
 
 void Shader::SetUniform1i(const std::string& name, int value) {
-    glUniform1i(GetUniformLocation(name), value);
+    SetUniform1i(GetUniformLocation(name), value);
+}
+
+void Shader::SetUniform1i(int location, int value) {
+    glUniform1i(location, value);
+}
+
+void Shader::SetUniform1f(const std::string& name, float value) {
+    SetUniform1f(GetUniformLocation(name), value);
+}
+
+void Shader::SetUniform1f(int location, float value) {
+    glUniform1f(location, value);
+}
+
+void Shader::SetUniform2f(const std::string& name, float v0, float v1) {
+    SetUniform2f(GetUniformLocation(name), v0, v1);
+}
+
+void Shader::SetUniform2f(int location, float v0, float v1) {
+    glUniform2f(location, v0, v1);
 }
 
 void Shader::SetUniform4f(const std::string& name, float v0, float v1, float v2, float v3) {
-    glUniform4f(GetUniformLocation(name), v0, v1, v2, v3);
+    SetUniform4f(GetUniformLocation(name), v0, v1, v2, v3);
+}
+
+void Shader::SetUniform4f(int location, float v0, float v1, float v2, float v3) {
+    glUniform4f(location, v0, v1, v2, v3);
 }
 
 void Shader::SetUniformMat4f(const std::string& name, const glm::mat4 matrix) {
-    glUniformMatrix4fv(GetUniformLocation(name), 1, false, &matrix[0][0]);
+    SetUniformMat4f(GetUniformLocation(name), matrix);
+}
+
+void Shader::SetUniformMat4f(int location, const glm::mat4& matrix) {
+    glUniformMatrix4fv(location, 1, false, &matrix[0][0]);
+}
+
+void Shader::ResolveUniforms() {
+    int count = 0;
+    glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &count);
+
+    char name[256];
+    for (int i = 0; i < count; i++) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_RendererID, i, sizeof(name), &length, &size, &type, name);
+
+        // Members of uniform blocks have no location and are skipped
+        int location = glGetUniformLocation(m_RendererID, name);
+        if (location == -1) continue;
+
+        std::string key(name, length);
+        m_UniformLocationCache[key] = location;
+
+        // Arrays are reported as "name[0]"; also accept the bare name
+        if (key.size() > 3 && key.compare(key.size() - 3, 3, "[0]") == 0) {
+            m_UniformLocationCache[key.substr(0, key.size() - 3)] = location;
+        }
+    }
 }
 
-unsigned int Shader::GetUniformLocation(const std::string& name) {
-    if (m_UniformLocationCache.find(name) != m_UniformLocationCache.end()) {
-        return m_UniformLocationCache[name];
+int Shader::GetUniformLocation(const std::string& name) {
+    auto it = m_UniformLocationCache.find(name);
+    if (it != m_UniformLocationCache.end()) {
+        return it->second;
     }
 
     int location = glGetUniformLocation(m_RendererID, name.c_str());
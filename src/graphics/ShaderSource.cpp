@@ -0,0 +1,27 @@
+#include "ShaderSource.h"
+
+#include <fstream>
+
+ShaderProgramSource ShaderSource::Parse(std::istream& stream) {
+    ShaderProgramSource source;
+    std::string* stage = nullptr;  // Stage the current line belongs to.
+    std::string line;
+
+    while (std::getline(stream, line)) {
+        if (line.find("# shader") != std::string::npos) {
+            if (line.find("vertex") != std::string::npos) {
+                stage = &source.VertexSource;
+            } else if (line.find("fragment") != std::string::npos) {
+                stage = &source.FragmentSource;
+            }
+        } else if (stage) {
+            stage->append(line).push_back('\n');
+        }
+    }
+    return source;
+}
+
+ShaderProgramSource ShaderSource::Load(const std::string& path) {
+    std::ifstream stream(path);
+    return Parse(stream);
+}
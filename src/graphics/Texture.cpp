@@ -1,5 +1,8 @@
 #include "Texture.h"
 
+#include "GLState.h"
+#include "GpuMemory.h"
+
 #ifndef STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image/stb_image.h"
@@ -8,7 +11,7 @@
 Texture::Texture(const std::string& path)
     : m_RendererID(0), m_FilePath(path), m_LocalBuffer(nullptr), m_Width(0), m_Height(0), m_BPP(0) {
     glGenTextures(1, &m_RendererID);
-    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    Bind();
 
     stbi_set_flip_vertically_on_load(1);                                      // Flips the texture vertically (bottom becomes top left)
     m_LocalBuffer = stbi_load(path.c_str(), &m_Width, &m_Height, &m_BPP, 4);  // 4 cz RGBA
@@ -19,6 +22,7 @@ Texture::Texture(const std::string& path)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_Width, m_Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_LocalBuffer);
+    GpuMemory::Add(GpuMemoryTag::Textures, GetBytes());
     Unbind();
 
     if (m_LocalBuffer) {
@@ -27,14 +31,15 @@ Texture::Texture(const std::string& path)
 }
 
 Texture::~Texture() {
+    GLState::OnDeleteTexture(m_RendererID);
     glDeleteTextures(1, &m_RendererID);
+    GpuMemory::Add(GpuMemoryTag::Textures, -GetBytes());
 }
 
 void Texture::Bind(unsigned int slot) const {
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    GLState::BindTexture(slot, m_RendererID);
 }
 
-void Texture::Unbind() const {
-    glBindTexture(GL_TEXTURE_2D, 0);
+void Texture::Unbind(unsigned int slot) const {
+    GLState::BindTexture(slot, 0);
 }
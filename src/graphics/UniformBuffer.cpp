@@ -0,0 +1,24 @@
+#include "UniformBuffer.h"
+
+#include "GLState.h"
+#include "GpuMemory.h"
+
+UniformBuffer::UniformBuffer(GLsizeiptr size, unsigned int bindingPoint)
+    : m_Size(size), m_BindingPoint(bindingPoint) {
+    glGenBuffers(1, &m_RendererID);
+    GLState::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+    glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, m_RendererID);
+    GpuMemory::Add(GpuMemoryTag::Uniforms, size);
+}
+
+UniformBuffer::~UniformBuffer() {
+    GLState::OnDeleteBuffer(m_RendererID);
+    glDeleteBuffers(1, &m_RendererID);
+    GpuMemory::Add(GpuMemoryTag::Uniforms, -static_cast<int64_t>(m_Size));
+}
+
+void UniformBuffer::Update(const void* data, GLsizeiptr size) {
+    GLState::BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, size, data);
+}
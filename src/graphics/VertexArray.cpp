@@ -1,43 +1,67 @@
 #include "VertexArray.h"
 
-VertexArray::VertexArray() {
+#include "GLState.h"
+
+VertexArray::VertexArray() : m_NumVertices(0) {
     glGenVertexArrays(1, &m_RendererID);
 }
 
 VertexArray::~VertexArray() {
+    GLState::OnDeleteVertexArray(m_RendererID);
     glDeleteVertexArrays(1, &m_RendererID);
 }
 
-void VertexArray::AddBuffer(const VertexBuffer& vb) {
-    Bind();     // Bind the VAO.
-    vb.Bind();  // Bind the associated VertexBuffer.
+void VertexArray::AddBuffer(const VertexBuffer& vb, unsigned int firstAttribute, unsigned int divisor, GLintptr baseOffset) {
+    Bind();  // Bind the VAO.
 
     const auto& elements = vb.GetElements();
-    unsigned int offset = 0;
+    GLintptr offset = baseOffset;
 
-    for (unsigned int attributeIndex = 0; attributeIndex < elements.size(); attributeIndex++) {
-        const auto element = elements[attributeIndex];
+    if (m_Attributes.size() < firstAttribute + elements.size()) m_Attributes.resize(firstAttribute + elements.size());
 
-        glEnableVertexAttribArray(attributeIndex);
-        glVertexAttribPointer(
-            attributeIndex,      // Index of the attribute.
-            element.count,       // Number of components (e.g., 3 for vec3).
-            element.type,        // Data type (e.g., GL_FLOAT).
-            element.normalized,  // Normalize data or not (e.g., GL_TRUE).
-            vb.GetStride(),      // Stride: Distance between consecutive vertices.
-            (const void*)offset  // Offset: Start position in the buffer for this attribute.
-        );
+    for (unsigned int i = 0; i < elements.size(); i++) {
+        const auto element = elements[i];
+        unsigned int attributeIndex = firstAttribute + i;
 
+        Attribute wanted = {vb.GetRendererID(), offset, vb.GetStride(), element.type, element.count, divisor, true};
+        Attribute& current = m_Attributes[attributeIndex];
         offset += element.count * VertexBufferElement::GetSizeOfType(element.type);
+
+        // Enable, pointer and divisor would all be no-ops
+        if (current == wanted) {
+            GLState::CountSkipped(3);
+            continue;
+        }
+
+        vb.Bind();  // The pointer is taken from the bound ARRAY_BUFFER.
+        if (!current.enabled) {
+            glEnableVertexAttribArray(attributeIndex);
+            GLState::CountIssued(1);
+        }
+        glVertexAttribPointer(
+            attributeIndex,             // Index of the attribute.
+            element.count,              // Number of components (e.g., 3 for vec3).
+            element.type,               // Data type (e.g., GL_FLOAT).
+            element.normalized,         // Normalize data or not (e.g., GL_TRUE).
+            vb.GetStride(),             // Stride: Distance between consecutive vertices.
+            (const void*)wanted.offset  // Offset: Start position in the buffer for this attribute.
+        );
+        GLState::CountIssued(1);
+        if (current.divisor != divisor || !current.enabled) {
+            glVertexAttribDivisor(attributeIndex, divisor);
+            GLState::CountIssued(1);
+        }
+        current = wanted;
     }
 
-    m_NumVertices = vb.GetSize() / vb.GetStride();
+    // Instance data does not change how many vertices a draw walks through
+    if (divisor == 0) m_NumVertices = vb.GetSize() / vb.GetStride();
 }
 
 void VertexArray::Bind() const {
-    glBindVertexArray(m_RendererID);
+    GLState::BindVertexArray(m_RendererID);
 }
 
 void VertexArray::Unbind() const {
-    glBindVertexArray(0);
+    GLState::BindVertexArray(0);
 }
@@ -1,17 +1,92 @@
 #include "VertexBuffer.h"
 
-VertexBuffer::VertexBuffer(const void* data, GLsizeiptr size)
-    : m_Size(size), m_Stride(0) {
-    glGenBuffers(1, &m_RendererID);                             // Generate a buffer ID.
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);                // Bind the buffer as an ARRAY_BUFFER.
-    glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);  // Upload data to GPU.
+#include <cassert>
+#include <cstring>
+
+#include "GLState.h"
+#include "Profiler.h"
+
+namespace {
+
+constexpr GLbitfield STREAM_MAP_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+constexpr GLuint64 FENCE_TIMEOUT_NS = 1000000000;  // Re-check a stuck fence once a second.
+
+}  // namespace
+
+VertexBuffer::VertexBuffer(const void* data, GLsizeiptr size, VertexBufferUsage usage, GpuMemoryTag tag)
+    : m_Size(size), m_Stride(0), m_Usage(usage), m_Tag(tag) {
+    glGenBuffers(1, &m_RendererID);  // Generate a buffer ID.
+    Bind();                          // Bind the buffer as an ARRAY_BUFFER.
+
+    if (usage == VertexBufferUsage::Dynamic) {
+        glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);  // Upload data to GPU.
+        GpuMemory::Add(m_Tag, size);
+        return;
+    }
+
+    if (GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage) {
+        // Immutable storage mapped once for the buffer's whole life
+        GLsizeiptr total = size * STREAM_REGIONS;
+        glBufferStorage(GL_ARRAY_BUFFER, total, nullptr, STREAM_MAP_FLAGS);
+        m_Mapped = static_cast<unsigned char*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, total, STREAM_MAP_FLAGS));
+        if (m_Mapped && data) {
+            for (unsigned int i = 0; i < STREAM_REGIONS; i++) std::memcpy(m_Mapped + i * size, data, size);
+        }
+    }
+
+    if (!m_Mapped) {
+        m_Staging.assign(size, 0);
+        if (data) std::memcpy(m_Staging.data(), data, size);
+        glBufferData(GL_ARRAY_BUFFER, size, data, GL_STREAM_DRAW);
+    }
+    GpuMemory::Add(m_Tag, size * GetStreamRegions());
 }
 
 VertexBuffer::~VertexBuffer() {
-    glDeleteBuffers(1, &m_RendererID);
+    for (GLsync fence : m_Fences) {
+        if (fence) glDeleteSync(fence);
+    }
+    GLState::OnDeleteBuffer(m_RendererID);
+    glDeleteBuffers(1, &m_RendererID);  // Also releases a persistent mapping.
+    GpuMemory::Add(m_Tag, -static_cast<int64_t>(m_Size) * GetStreamRegions());
+}
+
+void* VertexBuffer::MapStream() {
+    PROFILE_ZONE("VertexBuffer map");
+    if (!m_Mapped) return m_Staging.data();
+
+    GLsync& fence = m_Fences[m_Region];
+    if (fence) {
+        // Normally already signalled; only a GPU two frames behind makes this wait
+        while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS) == GL_TIMEOUT_EXPIRED) {
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+    return m_Mapped + GetStreamOffset();
+}
+
+void VertexBuffer::UnmapStream(GLsizeiptr size) {
+    if (m_Mapped || size <= 0) return;
+    PROFILE_ZONE("VertexBuffer orphan");
+
+    // Orphan the old store so the driver need not wait for draws still reading it
+    Bind();
+    glBufferData(GL_ARRAY_BUFFER, m_Size, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, size, m_Staging.data());
+}
+
+void VertexBuffer::FenceStream() {
+    if (!m_Mapped) return;
+
+    m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_Region = (m_Region + 1) % STREAM_REGIONS;
 }
 
 void VertexBuffer::Update(const void* data, GLsizeiptr size) {
+    // Stream storage may be immutable and is read by frames still in flight; write it through `MapStream`
+    assert(m_Usage == VertexBufferUsage::Dynamic);
+    PROFILE_ZONE("VertexBuffer update");
     Bind();  // Bind the buffer to ensure it is active.
 
     if (size <= m_Size) {
@@ -20,14 +95,22 @@ void VertexBuffer::Update(const void* data, GLsizeiptr size) {
     } else {
         // Reallocate and update if the new size is larger.
         glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+        GpuMemory::Add(m_Tag, size - m_Size);
         m_Size = size;  // Update the stored buffer size.
     }
 }
 
+void VertexBuffer::UpdateRange(GLintptr offset, const void* data, GLsizeiptr size) {
+    assert(m_Usage == VertexBufferUsage::Dynamic);
+    PROFILE_ZONE("VertexBuffer update");
+    Bind();
+    glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+}
+
 void VertexBuffer::Bind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 }
 
 void VertexBuffer::Unbind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    GLState::BindBuffer(GL_ARRAY_BUFFER, 0);
 }
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+/*
+Counts heap allocations made through the global operator new, and the bytes
+they hold. Debug builds (_DEBUG) replace operator new and delete to keep the
+counts; other builds leave them alone, report IsEnabled() false and zeros.
+*/
+namespace AllocationCounter {
+
+/// True when this build counts allocations.
+bool IsEnabled();
+
+/// Calls to operator new since the program started.
+uint64_t GetAllocations();
+
+/// Bytes allocated through operator new and not yet deleted.
+int64_t GetLiveBytes();
+
+/// Most bytes that were live at once.
+int64_t GetPeakBytes();
+
+}  // namespace AllocationCounter
+
+/**
+ * @class FrameAllocationCheck
+ * @brief Asserts that steady-state frames do not touch the heap.
+ *
+ * Call `Begin` and `End` around the work of one frame. The first
+ * `warmupFrames` frames may allocate (shader compiles, first-use growth of
+ * reserved containers); after that any allocation between `Begin` and `End`
+ * is reported and fails an assert. Does nothing when counting is disabled.
+ */
+class FrameAllocationCheck {
+   private:
+    unsigned int m_WarmupFrames;
+    unsigned int m_Frames = 0;
+    uint64_t m_Start = 0;
+
+   public:
+    explicit FrameAllocationCheck(unsigned int warmupFrames = 120);
+
+    void Begin();
+
+    /**
+     * @return Allocations since `Begin`.
+     */
+    uint64_t End();
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "IndexBuffer.h"
+#include "Renderer.h"
+#include "ResourceCache.h"
+#include "Shader.h"
+#include "UniformBuffer.h"
+#include "VertexArray.h"
+#include "VertexBuffer.h"
+#include "glm/glm.hpp"
+
+/**
+ * @struct Color8
+ * @brief 8-bit RGBA color.
+ */
+struct Color8 {
+    uint8_t r, g, b, a;
+};
+
+/**
+ * @struct QuadInstance
+ * @brief One axis-aligned rectangle in window pixels; the unit of everything the batch draws.
+ */
+struct QuadInstance {
+    float x, y;           // Bottom-left corner.
+    float width, height;
+    Color8 color;         // Alpha 0 is not drawn.
+};
+static_assert(sizeof(QuadInstance) == 20, "QuadInstance layout must match the vertex attributes");
+
+/// Shader a quad is drawn with.
+enum class BatchMaterial : uint8_t {
+    Solid,      // Filled with its color.
+    GridLines,  // Only the cell edges inside the rectangle, `FrameUniforms::cellSize` apart.
+};
+
+/// Draw order; later layers cover earlier ones.
+enum class BatchLayer : uint8_t {
+    Background,
+    Board,  // Retained quads are drawn at the start of this layer.
+    Pieces,
+    Overlay,
+    Count,  // Number of layers, not a layer.
+};
+
+/**
+ * @struct BatchStats
+ * @brief What the last `End` sent to the GPU.
+ */
+struct BatchStats {
+    unsigned int drawCalls = 0;
+    unsigned int instances = 0;
+    unsigned int vertices = 0;   // Quad corners processed, 4 per instance.
+    size_t uploadBytes = 0;      // Instance data written for the GPU.
+    size_t layerBytes[static_cast<int>(BatchLayer::Count)] = {};  // Instance data each layer holds; Board includes the retained slots.
+};
+
+/**
+ * @class BatchRenderer
+ * @brief Collects a frame's quads into one instance buffer and draws them in as few calls as possible.
+ *
+ * The buffer has two parts. Retained quads (the locked board) live at the front
+ * in fixed slots and are only re-uploaded where they changed. Streamed quads
+ * (pieces, previews, overlays) are submitted every frame between `Begin` and
+ * `End`. At `End` they are sorted by layer and material, and each run of
+ * neighbouring quads with the same material becomes one instanced draw.
+ *
+ * The instance data goes through a streaming `VertexBuffer`, so each frame writes
+ * a region the GPU is not reading. Every region keeps its own copy of the
+ * retained slots and is brought up to date only where they changed since it was
+ * last written.
+ */
+class BatchRenderer {
+   private:
+    struct Item {
+        uint16_t key;     // layer << 8 | material, the sort order.
+        uint32_t index;   // Submission order, to keep the sort stable.
+        QuadInstance quad;
+    };
+
+    VertexArray m_VAO;
+    std::shared_ptr<VertexBuffer> m_QuadVBO;  // Shared unit quad.
+    std::unique_ptr<VertexBuffer> m_InstanceVBO;
+    std::shared_ptr<IndexBuffer> m_IBO;
+    std::shared_ptr<Shader> m_Shaders[2];  // Indexed by BatchMaterial.
+    Renderer m_Renderer;
+
+    std::vector<QuadInstance> m_Retained;
+    size_t m_RetainedCapacity;
+
+    // Retained slots each stream region has not seen yet, as [begin, end)
+    struct DirtyRange {
+        size_t begin = SIZE_MAX, end = 0;
+    };
+    DirtyRange m_Dirty[VertexBuffer::STREAM_REGIONS];
+    unsigned int m_Region = 0;  // Stream region written by the next `End`.
+
+    void MarkDirty(size_t begin, size_t end);
+
+    std::vector<Item> m_Items;
+    size_t m_StreamCapacity;
+
+    BatchStats m_Stats;
+
+    /// Sorts the frame's items and writes them and the dirty retained slots; returns where the retained run goes.
+    size_t Upload();
+    void Draw(BatchMaterial material, size_t firstInstance, size_t count);
+
+   public:
+    /**
+     * @param retainedCapacity Fixed slots at the front of the buffer.
+     * @param streamCapacity Quads that can be submitted per frame; extra ones are dropped.
+     * @param resources Where the shaders and the unit quad come from.
+     *
+     * Projection and cell size come from the `Frame` uniform block, see `FrameUniforms`.
+     */
+    BatchRenderer(size_t retainedCapacity, size_t streamCapacity, ResourceCache& resources);
+
+    /// Makes `count` retained slots (at most the capacity), all transparent.
+    void ResizeRetained(size_t count);
+
+    /// Changes one retained slot; only changed slots are uploaded at `End`.
+    void SetRetained(size_t index, const QuadInstance& quad);
+
+    /// Starts collecting a frame.
+    void Begin();
+
+    void Submit(BatchLayer layer, BatchMaterial material, const QuadInstance& quad);
+
+    /// Uploads and draws everything since `Begin`, plus the retained quads.
+    void End();
+
+    inline const BatchStats& GetStats() const { return m_Stats; };
+};
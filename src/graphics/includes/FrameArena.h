@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+/**
+ * @class FrameArena
+ * @brief Linear allocator for memory that lives for one frame.
+ *
+ * One block is allocated up front; `Allocate` bumps an offset through it and
+ * `Reset` at the start of each frame makes all of it free again. Nothing is
+ * freed individually and no destructors run, so only trivially destructible
+ * types go in. When the block is full `Allocate` returns null and counts an
+ * overflow instead of falling back to the heap; `GetHighWater` tells how big
+ * the block needs to be.
+ */
+class FrameArena {
+   private:
+    std::unique_ptr<unsigned char[]> m_Buffer;
+    size_t m_Capacity;
+    size_t m_Offset = 0;
+    size_t m_HighWater = 0;       // Most bytes used in any frame.
+    unsigned int m_Overflows = 0; // Allocations refused since construction.
+
+   public:
+    explicit FrameArena(size_t capacity);
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @return `size` bytes aligned to `alignment` (a power of two), or null if the arena is full.
+     */
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @return Uninitialized room for `count` objects of `T`, or null if the arena is full.
+     */
+    template <typename T>
+    T* AllocateArray(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "FrameArena never runs destructors");
+        return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /// Frees everything allocated since the last reset.
+    void Reset();
+
+    inline size_t GetUsed() const { return m_Offset; };
+    inline size_t GetCapacity() const { return m_Capacity; };
+    inline size_t GetHighWater() const { return m_HighWater; };
+    inline unsigned int GetOverflows() const { return m_Overflows; };
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+
+/// Parts of a frame the loop times separately.
+enum class FramePhase : uint8_t {
+    Sim,     // Fixed-timestep ticks and input.
+    Render,  // Building and submitting the frame's draws.
+    Swap,    // Waiting on present: buffer swap with vsync, or glFinish offscreen.
+    Other,   // The rest of the frame: events, title, logging.
+    Count,
+};
+
+/// Lowercase name for logs and CSV, e.g. "render".
+const char* GetFramePhaseName(FramePhase phase);
+
+/**
+ * @struct FrameSample
+ * @brief Timings of one frame in milliseconds.
+ */
+struct FrameSample {
+    uint64_t frame;
+    float total;
+    float phases[static_cast<int>(FramePhase::Count)];
+    bool jank;         // Took over `FrameStats::JANK_FACTOR` vsync budgets.
+    FramePhase cause;  // For janky frames, the phase that ran furthest over its usual time.
+};
+
+/**
+ * @struct FrameTimeSummary
+ * @brief Frame-time percentiles over a run of recent frames, in milliseconds.
+ */
+struct FrameTimeSummary {
+    size_t frames = 0;
+    double p50 = 0.0, p95 = 0.0, p99 = 0.0, max = 0.0;
+    unsigned int janks = 0;
+};
+
+/**
+ * @class FrameStats
+ * @brief Records every frame's phase timings and flags the ones that miss vsync.
+ *
+ * Samples go into a ring buffer of the last `capacity` frames. The frame loop
+ * is the only writer. Each slot is a small seqlock: its sequence number is odd
+ * while the writer fills it, and every field is a relaxed atomic. A reader on
+ * another thread (`CopyRecent`) never blocks the writer; it drops any slot whose
+ * sequence changed while it was being copied.
+ *
+ * A frame is janky when it takes more than `JANK_FACTOR` times the budget, i.e.
+ * it most likely missed a vblank. It is blamed on the phase that exceeded its
+ * moving average (kept over smooth frames only) by the most, so a long swap
+ * wait behind a slow render is still put down to the render.
+ */
+class FrameStats {
+   public:
+    static constexpr double JANK_FACTOR = 1.5;
+    static constexpr size_t WINDOW = 600;  // Frames `Summarize` looks at, 10 s at 60 Hz.
+
+   private:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};  // 2 * frame + 1 while being written, 2 * frame + 2 once complete.
+        std::atomic<float> total{0.0f};
+        std::atomic<float> phases[static_cast<int>(FramePhase::Count)] = {};
+        std::atomic<bool> jank{false};
+        std::atomic<FramePhase> cause{FramePhase::Other};
+    };
+
+    std::unique_ptr<Slot[]> m_Slots;
+    size_t m_Capacity;                // Power of two.
+    std::atomic<uint64_t> m_Count{0};  // Samples ever recorded; the next goes to slot `m_Count % m_Capacity`.
+
+    double m_BudgetMs;
+    float m_Baseline[static_cast<int>(FramePhase::Count)] = {};  // Moving average of each phase in smooth frames.
+
+    // Janky frames blamed on each phase, all time; written by the recording thread only
+    std::atomic<uint64_t> m_Janks[static_cast<int>(FramePhase::Count)] = {};
+
+    std::unique_ptr<FrameSample[]> m_Scratch;  // `WINDOW` samples for `Summarize`, so it never allocates.
+    std::unique_ptr<float[]> m_Totals;
+
+   public:
+    /**
+     * @param budgetMs Time one frame may take, normally the display's refresh interval.
+     * @param capacity Frames kept, rounded up to a power of two.
+     */
+    explicit FrameStats(double budgetMs, size_t capacity = 1 << 16);
+
+    FrameStats(const FrameStats&) = delete;
+    FrameStats& operator=(const FrameStats&) = delete;
+
+    /**
+     * @brief Adds a frame; `total` may exceed the phases' sum, the rest counts as `Other`.
+     *
+     * @return The sample as stored, with its jank flag and cause filled in.
+     */
+    FrameSample Record(double simMs, double renderMs, double swapMs, double totalMs);
+
+    /**
+     * @brief Copies up to `count` of the most recent samples, oldest first. Safe from any thread.
+     *
+     * Samples the writer overwrites while they are being copied are left out.
+     *
+     * @return Samples copied.
+     */
+    size_t CopyRecent(FrameSample* out, size_t count) const;
+
+    /// Percentiles of the last `WINDOW` frames. Only from the recording thread; uses internal scratch.
+    FrameTimeSummary Summarize();
+
+    /// Prints `Summarize` and the janks so far by cause.
+    void PrintSummary(std::ostream& out);
+
+    /// Writes every kept sample, one line per frame.
+    bool WriteCsv(const std::string& path) const;
+
+    inline uint64_t GetFrames() const { return m_Count.load(std::memory_order_acquire); };
+    inline double GetBudget() const { return m_BudgetMs; };
+    inline uint64_t GetJanks(FramePhase cause) const {
+        return m_Janks[static_cast<int>(cause)].load(std::memory_order_relaxed);
+    };
+    uint64_t GetJanks() const;
+};
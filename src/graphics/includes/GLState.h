@@ -0,0 +1,64 @@
+#pragma once
+
+#include <GL/glew.h>
+
+/**
+ * @struct GLStateStats
+ * @brief Binding calls that reached the driver and those `GLState` dropped as no-ops.
+ */
+struct GLStateStats {
+    unsigned int issued = 0;
+    unsigned int skipped = 0;
+};
+
+/**
+ * @class GLState
+ * @brief Shadows the bindings of the current context and skips calls that would not change them.
+ *
+ * Every bind in the graphics classes goes through here instead of calling GL
+ * directly. Tracked: the program, the VAO, the array, element array and
+ * uniform buffer bindings, the active texture unit, the 2D texture of each
+ * unit and the point size. The element array binding belongs to the VAO, so
+ * it is forgotten whenever the VAO changes.
+ *
+ * Code that changes bindings behind its back (another library, raw GL calls)
+ * must call `Invalidate` afterwards.
+ */
+class GLState {
+   public:
+    static constexpr unsigned int MAX_TEXTURE_UNITS = 16;
+
+    static void UseProgram(GLuint program);
+    static void BindVertexArray(GLuint vertexArray);
+
+    /// Only `GL_ARRAY_BUFFER`, `GL_ELEMENT_ARRAY_BUFFER` and `GL_UNIFORM_BUFFER` are tracked; other targets pass through.
+    static void BindBuffer(GLenum target, GLuint buffer);
+
+    /// Binds a `GL_TEXTURE_2D` to `unit`, selecting the unit first if needed.
+    static void BindTexture(unsigned int unit, GLuint texture);
+
+    static void PointSize(float size);
+
+    /**
+     * @brief Records calls a caller skipped on its own, e.g. attribute pointers a VAO already had.
+     */
+    static void CountSkipped(unsigned int calls);
+
+    /**
+     * @brief Records calls a caller issued on its own.
+     */
+    static void CountIssued(unsigned int calls);
+
+    /// Forgets a deleted object, whose bindings GL resets to 0.
+    static void OnDeleteProgram(GLuint program);
+    static void OnDeleteVertexArray(GLuint vertexArray);
+    static void OnDeleteBuffer(GLuint buffer);
+    static void OnDeleteTexture(GLuint texture);
+
+    /// Forgets everything, so the next call of each kind always reaches the driver.
+    static void Invalidate();
+
+    /// Counts since the last `ResetStats`; reset once per frame to read per-frame numbers.
+    static const GLStateStats& GetStats();
+    static void ResetStats();
+};
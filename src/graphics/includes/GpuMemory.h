@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+/// What a GL buffer or texture holds, for `GpuMemory` accounting.
+enum class GpuMemoryTag : uint8_t {
+    Other,
+    Meshes,     // Shared geometry from the ResourceCache (unit quad and its indices).
+    Instances,  // Per-quad data streamed by the BatchRenderer.
+    Uniforms,
+    Textures,
+    Count,
+};
+
+/*
+Bytes of GL buffer and texture storage the program has asked for, by tag.
+VertexBuffer, IndexBuffer, UniformBuffer and Texture add their storage when
+they allocate it and remove it when they are deleted. This is what was
+requested from the driver, not what it actually keeps resident.
+*/
+namespace GpuMemory {
+
+/// Adds `bytes` (negative to release) under `tag`.
+void Add(GpuMemoryTag tag, int64_t bytes);
+
+int64_t GetBytes(GpuMemoryTag tag);
+
+int64_t GetTotalBytes();
+
+/// Short lowercase name for logs, e.g. "instances".
+const char* GetTagName(GpuMemoryTag tag);
+
+}  // namespace GpuMemory
@@ -2,6 +2,8 @@
 
 #include <GL/glew.h>
 
+#include "GpuMemory.h"
+
 /**
  * @class IndexBuffer
  * @brief Encapsulates an OpenGL Index Buffer Object (IBO) for storing indices used in indexed rendering.
@@ -10,6 +12,7 @@ class IndexBuffer {
    private:
     unsigned int m_RendererID;  // OpenGL ID for the index buffer.
     unsigned int m_Count;       // Number of indices stored in the buffer.
+    GpuMemoryTag m_Tag;         // Where the storage is counted in GpuMemory.
 
    public:
     /**
@@ -20,8 +23,9 @@ class IndexBuffer {
      *
      * @param data Pointer to the array of index data (e.g., GLuint indices).
      * @param count Number of indices in the buffer.
+     * @param tag Where its storage is counted in `GpuMemory`.
      */
-    IndexBuffer(const void* data, unsigned int count);
+    IndexBuffer(const void* data, unsigned int count, GpuMemoryTag tag = GpuMemoryTag::Other);
     ~IndexBuffer();
 
     /**
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "BatchRenderer.h"
+#include "GpuMemory.h"
+
+/**
+ * @struct MemorySnapshot
+ * @brief Heap, GPU and batch memory numbers at one point of a frame, for the overlay and the log.
+ *
+ * Heap numbers are 0 unless `AllocationCounter::IsEnabled()`.
+ */
+struct MemorySnapshot {
+    uint64_t frameAllocations = 0;  // Heap allocations in the last frame.
+    int64_t heapLiveBytes = 0;
+    int64_t heapPeakBytes = 0;
+    int64_t gpuBytes[static_cast<int>(GpuMemoryTag::Count)] = {};
+    size_t layerBytes[static_cast<int>(BatchLayer::Count)] = {};  // From `BatchStats::layerBytes`.
+
+    /**
+     * @param frameAllocations What `FrameAllocationCheck::End` returned for the last frame.
+     * @param batch Stats of the batch's last `End`.
+     */
+    static MemorySnapshot Take(uint64_t frameAllocations, const BatchStats& batch);
+
+    /**
+     * @brief Writes the snapshot as one log line, without a newline.
+     *
+     * @return The length `snprintf` reports; the line is cut short if `size` is too small.
+     */
+    int Format(char* out, size_t size) const;
+};
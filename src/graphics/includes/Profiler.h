@@ -0,0 +1,139 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*
+Profiling zones are compiled in only when TETRIX_PROFILE is defined (CMake option
+TETRIX_PROFILE); otherwise the macros below expand to nothing and cost nothing.
+
+    PROFILE_FRAME();                 // once per frame, before its first zone
+    PROFILE_ZONE("Update");          // CPU time until the end of the scope
+    PROFILE_GPU_ZONE("Draw");        // CPU time plus GPU time from a GL_TIME_ELAPSED query
+
+Zone names must be string literals (or otherwise outlive the profiler); they are
+kept by pointer.
+*/
+#ifdef TETRIX_PROFILE
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_FRAME() Profiler::BeginFrame()
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#define PROFILE_GPU_ZONE(name) ProfileGpuZone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#else
+#define PROFILE_FRAME() ((void)0)
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_GPU_ZONE(name) ((void)0)
+#endif
+
+/**
+ * @struct ProfileZoneStats
+ * @brief Per-frame cost of one zone over the last `Profiler::WINDOW` frames.
+ */
+struct ProfileZoneStats {
+    const char* name;
+    double calls;    // Average entries per frame.
+    double cpuMean;  // Milliseconds per frame, summed over all entries.
+    double cpuMax;
+    double gpuMean;  // Zero for zones without GPU timing.
+    double gpuMax;
+};
+
+/**
+ * @class Profiler
+ * @brief Collects CPU and GPU timings of named zones for the GL thread.
+ *
+ * CPU zones are timed with `std::chrono::steady_clock`. GPU zones also wrap
+ * their GL commands in a `GL_TIME_ELAPSED` query. Queries live in a ring of
+ * `QUERY_FRAMES` frames and are read back `QUERY_FRAMES - 1` frames later, only
+ * if the driver says they are ready, so profiling never waits on the GPU; a
+ * frame whose results are still pending is dropped instead. Timer queries do
+ * not nest, so a GPU zone opened inside another only records CPU time.
+ *
+ * Not thread safe: use it from the thread that owns the GL context.
+ */
+class Profiler {
+   public:
+    static constexpr unsigned int WINDOW = 120;         // Frames in the rolling statistics.
+    static constexpr unsigned int QUERY_FRAMES = 4;     // Frames of GPU queries in flight.
+    static constexpr unsigned int MAX_GPU_ZONES = 32;   // GPU zones per frame; more are CPU only.
+
+    /**
+     * @brief Closes the previous frame, folds its timings into the statistics and collects finished queries.
+     */
+    static void BeginFrame();
+
+    /// Nanoseconds on the profiler's clock.
+    static uint64_t Now();
+
+    static void RecordCpu(const char* name, uint64_t begin, uint64_t end);
+
+    /**
+     * @brief Starts a timer query for `name`.
+     * @return A ticket for `EndGpu`, or -1 if no query could be started.
+     */
+    static int BeginGpu(const char* name, uint64_t cpuBegin);
+    static void EndGpu(int ticket);
+
+    /**
+     * @brief Starts keeping every zone for `WriteChromeTrace`, up to `maxEvents` of them.
+     */
+    static void StartCapture(size_t maxEvents = 1 << 20);
+
+    /**
+     * @brief Writes the captured zones as Chrome trace event JSON (chrome://tracing, ui.perfetto.dev).
+     *
+     * GPU zones are drawn on their own track, starting where their CPU zone started.
+     *
+     * @return False if the file could not be written.
+     */
+    static bool WriteChromeTrace(const std::string& path);
+
+    static std::vector<ProfileZoneStats> GetStats();
+
+    /// Prints `GetStats` as a table, most expensive zone first.
+    static void PrintStats(std::ostream& out);
+};
+
+/**
+ * @class ProfileZone
+ * @brief Records the CPU time of its scope. Use through `PROFILE_ZONE`.
+ */
+class ProfileZone {
+   private:
+    const char* m_Name;
+    uint64_t m_Begin;
+
+   public:
+    explicit ProfileZone(const char* name) : m_Name(name), m_Begin(Profiler::Now()) {}
+    ~ProfileZone() { Profiler::RecordCpu(m_Name, m_Begin, Profiler::Now()); }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+};
+
+/**
+ * @class ProfileGpuZone
+ * @brief Records the CPU and GPU time of its scope. Use through `PROFILE_GPU_ZONE`.
+ */
+class ProfileGpuZone {
+   private:
+    const char* m_Name;
+    uint64_t m_Begin;
+    int m_Ticket;
+
+   public:
+    explicit ProfileGpuZone(const char* name)
+        : m_Name(name), m_Begin(Profiler::Now()), m_Ticket(Profiler::BeginGpu(name, m_Begin)) {}
+    ~ProfileGpuZone() {
+        Profiler::EndGpu(m_Ticket);
+        Profiler::RecordCpu(m_Name, m_Begin, Profiler::Now());
+    }
+
+    ProfileGpuZone(const ProfileGpuZone&) = delete;
+    ProfileGpuZone& operator=(const ProfileGpuZone&) = delete;
+};
@@ -47,4 +47,15 @@ class Renderer {
      * @param pointSize The size of the points to render. Default is 1.0.
      */
     void DrawPoints(const unsigned int& start, const VertexArray& va, const Shader& shader, const float& pointSize = 1.0f) const;
+
+    /**
+     * @brief Draws the indexed triangles of `ib` once per instance.
+     *
+     * - Binds the provided shader, vertex array, and index buffer.
+     * - Calls `glDrawElementsInstanced`; per-instance attributes come from buffers
+     *   added to `va` with a divisor.
+     *
+     * @param instanceCount Number of instances to draw; nothing is drawn for 0.
+     */
+    void DrawInstanced(const VertexArray& va, const IndexBuffer& ib, const Shader& shader, unsigned int instanceCount) const;
 };
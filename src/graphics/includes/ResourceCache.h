@@ -0,0 +1,110 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "IndexBuffer.h"
+#include "Shader.h"
+#include "VertexBuffer.h"
+
+/**
+ * @class ResourcePool
+ * @brief Shares one object per key between everyone holding a handle to it.
+ *
+ * Handles are `std::shared_ptr`s; the pool itself only keeps `std::weak_ptr`s,
+ * so an object is destroyed (and its GL name released) when the last handle
+ * goes, and created again on the next request.
+ */
+template <typename T>
+class ResourcePool {
+   private:
+    std::unordered_map<std::string, std::weak_ptr<T>> m_Entries;
+    unsigned int m_Loads = 0;  // Objects created.
+    unsigned int m_Hits = 0;   // Requests served by an existing object.
+
+   public:
+    /**
+     * @param key Identifies the object, e.g. its file path.
+     * @param create Called to make the object when no live one has this key.
+     * @return A handle to the shared object.
+     */
+    template <typename Factory>
+    std::shared_ptr<T> Acquire(const std::string& key, Factory&& create) {
+        std::weak_ptr<T>& entry = m_Entries[key];
+        if (std::shared_ptr<T> existing = entry.lock()) {
+            m_Hits++;
+            return existing;
+        }
+
+        std::shared_ptr<T> created = create();
+        entry = created;
+        m_Loads++;
+        return created;
+    }
+
+    /// Forgets keys whose object has been destroyed.
+    void Collect() {
+        for (auto it = m_Entries.begin(); it != m_Entries.end();) {
+            it = it->second.expired() ? m_Entries.erase(it) : std::next(it);
+        }
+    }
+
+    inline unsigned int GetLoads() const { return m_Loads; };
+    inline unsigned int GetHits() const { return m_Hits; };
+};
+
+/**
+ * @class ResourceCache
+ * @brief Reference-counted shaders and static buffers shared by every renderer of one GL context.
+ *
+ * A shader is parsed, compiled and linked once per path however many renderers
+ * use it. Static geometry such as the unit quad is uploaded once per name.
+ * Buffers a renderer writes itself (instance streams) and VAOs, which tie a
+ * renderer's own buffers together, stay with that renderer.
+ */
+class ResourceCache {
+   private:
+    ResourcePool<Shader> m_Shaders;
+    ResourcePool<VertexBuffer> m_VertexBuffers;
+    ResourcePool<IndexBuffer> m_IndexBuffers;
+
+   public:
+    /**
+     * @param path Path of a `# shader vertex` / `# shader fragment` file.
+     */
+    std::shared_ptr<Shader> GetShader(const std::string& path);
+
+    /**
+     * @brief Returns the static vertex buffer called `name`, uploading `data` if it does not exist yet.
+     *
+     * The name should also identify the layout, since a new buffer gets the
+     * elements pushed by `layout` and an existing one keeps its own.
+     *
+     * @param layout Called with the new buffer to push its elements.
+     */
+    template <typename Layout>
+    std::shared_ptr<VertexBuffer> GetVertexBuffer(const std::string& name, const void* data, GLsizeiptr size, Layout&& layout) {
+        return m_VertexBuffers.Acquire(name, [&]() {
+            auto vb = std::make_shared<VertexBuffer>(data, size, VertexBufferUsage::Dynamic, GpuMemoryTag::Meshes);
+            layout(*vb);
+            return vb;
+        });
+    }
+
+    /**
+     * @brief Returns the index buffer called `name`, uploading `count` indices from `data` if it does not exist yet.
+     */
+    std::shared_ptr<IndexBuffer> GetIndexBuffer(const std::string& name, const unsigned int* data, unsigned int count);
+
+    /// Forgets the keys of resources nobody holds any more.
+    void Collect();
+
+    /// Objects created over all resource types.
+    unsigned int GetLoads() const;
+
+    /// Requests served by an object that already existed.
+    unsigned int GetHits() const;
+};
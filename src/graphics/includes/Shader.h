@@ -5,17 +5,9 @@
 #include <string>
 #include <unordered_map>
 
+#include "ShaderSource.h"
 #include "glm/glm.hpp"
 
-/**
- * @struct ShaderProgramSource
- * @brief Stores the vertex and fragment shader source code.
- */
-struct ShaderProgramSource {
-    std::string VertexSource;    // Source code for the vertex shader.
-    std::string FragmentSource;  // Source code for the fragment shader.
-};
-
 /**
  * @class Shader
  * @brief Encapsulates the functionality of an OpenGL Shader Program.
@@ -26,14 +18,6 @@ class Shader {
     unsigned int m_RendererID;                                    // OpenGL ID for the shader program.
     std::unordered_map<std::string, int> m_UniformLocationCache;  // Cache for uniform locations.
 
-    /**
-     * @brief Parses the shader file and separates vertex and fragment shader code.
-     *
-     * @param file Path to the shader source file.
-     * @return A ShaderProgramSource struct containing the separated shader code.
-     */
-    ShaderProgramSource ParseShader(const std::string& file);
-
     /**
      * @brief Creates and links a shader program.
      *
@@ -53,14 +37,9 @@ class Shader {
     unsigned int CompileShader(unsigned int type, const std::string& source);
 
     /**
-     * @brief Retrieves the location of a uniform variable.
-     *
-     * Uses a cache to optimize uniform lookup.
-     *
-     * @param name Name of the uniform variable.
-     * @return The location of the uniform in the shader program.
+     * @brief Fills the location cache with every active uniform once the program is linked.
      */
-    unsigned int GetUniformLocation(const std::string& name);
+    void ResolveUniforms();
 
    public:
     /**
@@ -74,6 +53,27 @@ class Shader {
     void Bind() const;
     void Unbind() const;
 
+    /**
+     * @brief Retrieves the location of a uniform variable.
+     *
+     * Active uniforms are resolved when the program is linked, so this is a
+     * cache lookup. Resolve a handle once and pass it to the `int` overloads of
+     * `SetUniform*` on hot paths to skip the string hashing altogether.
+     *
+     * @param name Name of the uniform variable.
+     * @return The location of the uniform, or -1 if the program has no such uniform.
+     */
+    int GetUniformLocation(const std::string& name);
+
+    /**
+     * @brief Attaches a uniform block of this program to a binding point.
+     *
+     * @param name Name of the block in GLSL (e.g. `Frame`).
+     * @param bindingPoint Binding point the matching `UniformBuffer` is attached to.
+     * @return False if the program has no active block of that name.
+     */
+    bool BindUniformBlock(const std::string& name, unsigned int bindingPoint);
+
     /**
      * @brief Sets an integer uniform variable in the shader.
      *
@@ -81,6 +81,26 @@ class Shader {
      * @param value Integer value to set.
      */
     void SetUniform1i(const std::string& name, int value);
+    void SetUniform1i(int location, int value);
+
+    /**
+     * @brief Sets a float uniform variable in the shader.
+     *
+     * @param name Name of the uniform variable.
+     * @param value Float value to set.
+     */
+    void SetUniform1f(const std::string& name, float value);
+    void SetUniform1f(int location, float value);
+
+    /**
+     * @brief Sets a 2-component float uniform variable in the shader.
+     *
+     * @param name Name of the uniform variable.
+     * @param v0 First float value.
+     * @param v1 Second float value.
+     */
+    void SetUniform2f(const std::string& name, float v0, float v1);
+    void SetUniform2f(int location, float v0, float v1);
 
     /**
      * @brief Sets a 4-component float uniform variable in the shader.
@@ -92,6 +112,7 @@ class Shader {
      * @param v3 Fourth float value.
      */
     void SetUniform4f(const std::string& name, float v0, float v1, float v2, float v3);
+    void SetUniform4f(int location, float v0, float v1, float v2, float v3);
 
     /**
      * @brief Sets a 4x4 matrix uniform variable in the shader.
@@ -100,4 +121,5 @@ class Shader {
      * @param matrix The 4x4 matrix to set (in glm::mat4 format).
      */
     void SetUniformMat4f(const std::string& name, const glm::mat4 matrix);
+    void SetUniformMat4f(int location, const glm::mat4& matrix);
 };
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <istream>
+#include <string>
+
+/**
+ * @struct ShaderProgramSource
+ * @brief Stores the vertex and fragment shader source code.
+ */
+struct ShaderProgramSource {
+    std::string VertexSource;    // Source code for the vertex shader.
+    std::string FragmentSource;  // Source code for the fragment shader.
+};
+
+/*
+A shader file holds both stages, each after a `# shader vertex` or
+`# shader fragment` line. Splitting it needs no GL context, so it lives apart
+from Shader and tools without one (tetrix_bench) can use it.
+*/
+namespace ShaderSource {
+
+/**
+ * @brief Separates the vertex and fragment code of a shader file.
+ *
+ * Lines before the first `# shader` marker belong to no stage and are dropped.
+ */
+ShaderProgramSource Parse(std::istream& stream);
+
+/**
+ * @param path Path to the shader file; relative paths resolve from the working directory.
+ * @return The parsed stages, both empty if the file cannot be read.
+ */
+ShaderProgramSource Load(const std::string& path);
+
+}  // namespace ShaderSource
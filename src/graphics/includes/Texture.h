@@ -1,6 +1,8 @@
 #pragma once
 
 #include <GL/glew.h>
+
+#include <cstdint>
 #include <string>
 
 class Texture {
@@ -15,8 +17,11 @@ class Texture {
     ~Texture();
 
     void Bind(unsigned int slot = 0) const;
-    void Unbind() const;
+    void Unbind(unsigned int slot = 0) const;
 
     inline int GetWidth() const { return m_Width; }
     inline int GetHeight() const { return m_Height; }
+
+    /// Storage of the RGBA8 image on the GPU.
+    inline int64_t GetBytes() const { return static_cast<int64_t>(m_Width) * m_Height * 4; }
 };
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "glm/glm.hpp"
+
+/**
+ * @struct FrameUniforms
+ * @brief Per-frame values every program reads from the `Frame` uniform block.
+ *
+ * Laid out by std140 rules, so it must mirror the GLSL block member for member:
+ *
+ *     layout(std140) uniform Frame {
+ *         mat4 u_Projection;
+ *         vec2 u_CellSize;
+ *         float u_Time;
+ *     };
+ */
+struct FrameUniforms {
+    glm::mat4 projection;  // Window pixels to clip space.
+    glm::vec2 cellSize;    // Pixel size of one board cell.
+    float time;            // Seconds since start.
+    float padding;         // Rounds the block up to a vec4.
+};
+static_assert(sizeof(FrameUniforms) == 80, "FrameUniforms must follow the std140 layout of the Frame block");
+
+/// Binding points shared by every program's uniform blocks.
+namespace UniformBlock {
+
+constexpr const char* FRAME_NAME = "Frame";
+constexpr unsigned int FRAME_BINDING = 0;
+
+}  // namespace UniformBlock
+
+/**
+ * @class UniformBuffer
+ * @brief Encapsulates an OpenGL Uniform Buffer Object attached to one binding point.
+ *
+ * Programs whose block is bound to the same point (see `Shader::BindUniformBlock`)
+ * all read this buffer, so shared values are uploaded once instead of once per program.
+ */
+class UniformBuffer {
+   private:
+    unsigned int m_RendererID;     // OpenGL ID for the uniform buffer.
+    GLsizeiptr m_Size;             // Size of the block in bytes.
+    unsigned int m_BindingPoint;   // Indexed GL_UNIFORM_BUFFER binding it is attached to.
+
+   public:
+    /**
+     * @param size Size of the block in bytes.
+     * @param bindingPoint Binding point the buffer is attached to for its whole life.
+     */
+    UniformBuffer(GLsizeiptr size, unsigned int bindingPoint);
+    ~UniformBuffer();
+
+    UniformBuffer(const UniformBuffer&) = delete;
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    /**
+     * @brief Replaces the start of the block.
+     *
+     * @param data Pointer to the new contents.
+     * @param size Number of bytes; at most `GetSize()`.
+     */
+    void Update(const void* data, GLsizeiptr size);
+
+    inline GLsizeiptr GetSize() const { return m_Size; };
+    inline unsigned int GetBindingPoint() const { return m_BindingPoint; };
+};
@@ -1,11 +1,30 @@
 #pragma once
 
+#include <vector>
+
 #include "VertexBuffer.h"
 
 class VertexArray {
    private:
+    // What one attribute was last pointed at, to skip re-specifying it unchanged
+    struct Attribute {
+        GLuint buffer = 0;
+        GLintptr offset = 0;
+        unsigned int stride = 0;
+        unsigned int type = 0;
+        unsigned int count = 0;
+        unsigned int divisor = 0;
+        bool enabled = false;
+
+        bool operator==(const Attribute& other) const {
+            return buffer == other.buffer && offset == other.offset && stride == other.stride &&
+                   type == other.type && count == other.count && divisor == other.divisor && enabled == other.enabled;
+        }
+    };
+
     unsigned int m_RendererID;   // OpenGL ID for the Vertex Array Object.
     unsigned int m_NumVertices;  // Total number of vertices in the associated VertexBuffer.
+    std::vector<Attribute> m_Attributes;  // Indexed by attribute location.
 
    public:
     VertexArray();
@@ -13,8 +32,14 @@ class VertexArray {
 
     /**
      * @param vb The VertexBuffer containing vertex data and its layout.
+     * @param firstAttribute Attribute index of the buffer's first element, so several buffers can share one VAO.
+     * @param divisor 0 for per-vertex data, 1 to advance once per instance.
+     * @param baseOffset Byte offset of the first vertex (or instance) to read, so one buffer can feed several draws.
+     *
+     * Attributes that already point at the same place are left alone, so
+     * re-adding a buffer with an unchanged layout and offset costs no GL calls.
      */
-    void AddBuffer(const VertexBuffer& vb);
+    void AddBuffer(const VertexBuffer& vb, unsigned int firstAttribute = 0, unsigned int divisor = 0, GLintptr baseOffset = 0);
 
     void Bind() const;
     void Unbind() const;
@@ -4,6 +4,14 @@
 
 #include <vector>
 
+#include "GpuMemory.h"
+
+/// How a VertexBuffer's storage is allocated and written.
+enum class VertexBufferUsage {
+    Dynamic,  // One `glBufferData` store, rewritten with `Update`/`UpdateRange`.
+    Stream,   // Rewritten every frame through `MapStream`, see below.
+};
+
 struct VertexBufferElement {
     unsigned int type;        // The data type (e.g., GL_FLOAT, GL_UNSIGNED_INT).
     unsigned int count;       // Number of elements of the given type.
@@ -22,21 +30,48 @@ struct VertexBufferElement {
     }
 };
 
+/**
+ * @class VertexBuffer
+ * @brief Encapsulates an OpenGL Vertex Buffer Object and the layout of its vertices.
+ *
+ * A `VertexBufferUsage::Stream` buffer is split into `STREAM_REGIONS` regions of
+ * `size` bytes, allocated with `glBufferStorage` and mapped persistently. Each frame
+ * writes one region while the GPU may still be reading the other two; a fence per
+ * region makes `MapStream` wait only if the GPU is a full two frames behind. Drivers
+ * without `ARB_buffer_storage` get a single region that is orphaned and re-uploaded
+ * from a CPU copy instead.
+ */
 class VertexBuffer {
+   public:
+    static constexpr unsigned int STREAM_REGIONS = 3;
+
    private:
     GLuint m_RendererID;                          // OpenGL ID for the vertex buffer.
-    GLsizeiptr m_Size;                            // Total size of the vertex data in bytes.
+    GLsizeiptr m_Size;                            // Size of the vertex data in bytes (of one region when streaming).
     unsigned int m_Stride;                        // Total stride of the vertex layout in bytes.
     std::vector<VertexBufferElement> m_Elements;  // Layout elements of the buffer.
 
+    VertexBufferUsage m_Usage;
+    GpuMemoryTag m_Tag;                         // Where the storage is counted in GpuMemory.
+    unsigned char* m_Mapped = nullptr;          // Persistent mapping of all regions, null when orphaning.
+    std::vector<unsigned char> m_Staging;       // CPU copy written instead when orphaning.
+    GLsync m_Fences[STREAM_REGIONS] = {};       // Signalled once the GPU is done with each region.
+    unsigned int m_Region = 0;                  // Region the current frame writes.
+
    public:
     /**
-     * @param data A pointer to the vertex data.
-     * @param size The size of the vertex data in bytes.
+     * @param data A pointer to the vertex data, or null to leave it uninitialized.
+     * @param size The size of the vertex data in bytes; for `Stream`, the size of one region.
+     * @param usage Whether the buffer is updated occasionally or rewritten every frame.
+     * @param tag Where its storage is counted in `GpuMemory`.
      */
-    VertexBuffer(const void* data, GLsizeiptr size);
+    VertexBuffer(const void* data, GLsizeiptr size, VertexBufferUsage usage = VertexBufferUsage::Dynamic,
+                 GpuMemoryTag tag = GpuMemoryTag::Other);
     ~VertexBuffer();
 
+    VertexBuffer(const VertexBuffer&) = delete;
+    VertexBuffer& operator=(const VertexBuffer&) = delete;
+
     void Bind() const;
     void Unbind() const;
 
@@ -44,7 +79,8 @@ class VertexBuffer {
      * @brief Updates the buffer with new data.
      * 
      * If the new size is smaller or equal to the existing size, updates only the modified portion.
-     * Otherwise, reallocates the buffer with the new size.
+     * Otherwise, reallocates the buffer with the new size. Only for `Dynamic` buffers (asserted): a
+     * persistent `Stream` buffer has immutable storage that `glBufferSubData` may not write.
      * 
      * @param data Pointer to the new vertex data.
      * @param size Size of the new vertex data in bytes.
@@ -52,10 +88,56 @@ class VertexBuffer {
     void Update(const void* data, GLsizeiptr size);
 
     /**
-     * @return The size of the vertex buffer in bytes.
+     * @brief Overwrites part of the buffer in place with `glBufferSubData`. Only for `Dynamic` buffers (asserted).
+     *
+     * @param offset Byte offset of the first byte to replace.
+     * @param data Pointer to the replacement data.
+     * @param size Number of bytes; `offset + size` must not exceed `GetSize()`.
+     */
+    void UpdateRange(GLintptr offset, const void* data, GLsizeiptr size);
+
+    /**
+     * @brief Returns the region this frame writes, waiting first if the GPU still reads it.
+     *
+     * Only for `Stream` buffers. The memory keeps what was written to this region
+     * `GetStreamRegions()` frames ago, so callers may rewrite just what changed.
+     *
+     * @return `GetSize()` writable bytes.
+     */
+    void* MapStream();
+
+    /**
+     * @brief Makes the bytes written since `MapStream` visible to the GPU.
+     *
+     * A no-op with persistent mapping; when orphaning, uploads the first `size` bytes.
+     */
+    void UnmapStream(GLsizeiptr size);
+
+    /**
+     * @brief Fences the current region after the draws that read it and moves to the next one.
+     */
+    void FenceStream();
+
+    /**
+     * @return Byte offset of the current region, to add to attribute offsets.
+     */
+    inline GLintptr GetStreamOffset() const { return static_cast<GLintptr>(m_Region) * m_Size; };
+
+    /**
+     * @return How many regions the buffer cycles through: `STREAM_REGIONS`, or 1 when orphaning.
+     */
+    inline unsigned int GetStreamRegions() const { return m_Mapped ? STREAM_REGIONS : 1; };
+
+    /**
+     * @return The size of the vertex buffer in bytes (of one region for `Stream` buffers).
      */
     inline GLsizeiptr GetSize() const { return m_Size; };
 
+    /**
+     * @return The OpenGL ID of the buffer.
+     */
+    inline GLuint GetRendererID() const { return m_RendererID; };
+
     /**
      * @return The stride (in bytes) of the vertex layout.
      */
@@ -64,7 +146,7 @@ class VertexBuffer {
     /**
      * @return A reference to the vector of VertexBufferElements.
      */
-    inline const std::vector<VertexBufferElement> GetElements() const& { return m_Elements; };
+    inline const std::vector<VertexBufferElement>& GetElements() const& { return m_Elements; };
 
     /**
      * @tparam T The data type of the element (e.g., float, unsigned int).
@@ -0,0 +1,108 @@
+#include "OffscreenContext.h"
+
+#include <EGL/eglext.h>
+
+namespace {
+
+constexpr EGLint CONFIG_ATTRIBUTES[] = {
+    EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+    EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+    EGL_NONE,
+};
+
+constexpr EGLint CONTEXT_ATTRIBUTES[] = {
+    EGL_CONTEXT_MAJOR_VERSION, 3,
+    EGL_CONTEXT_MINOR_VERSION, 3,
+    EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+    EGL_NONE,
+};
+
+EGLDisplay OpenDisplay() {
+    // Mesa's surfaceless platform needs neither X nor a DRM device
+    auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (getPlatformDisplay) {
+        EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        if (display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr)) return display;
+    }
+
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr)) return display;
+    return EGL_NO_DISPLAY;
+}
+
+}  // namespace
+
+OffscreenContext::OffscreenContext(int width, int height)
+    : m_Width(width), m_Height(height) {
+    Create();
+}
+
+OffscreenContext::~OffscreenContext() {
+    if (m_Framebuffer) glDeleteFramebuffers(1, &m_Framebuffer);
+    if (m_Renderbuffer) glDeleteRenderbuffers(1, &m_Renderbuffer);
+
+    if (m_Display != EGL_NO_DISPLAY) {
+        eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (m_Context != EGL_NO_CONTEXT) eglDestroyContext(m_Display, m_Context);
+        eglTerminate(m_Display);
+    }
+}
+
+bool OffscreenContext::Create() {
+    m_Display = OpenDisplay();
+    if (m_Display == EGL_NO_DISPLAY) {
+        m_Error = "no EGL display";
+        return false;
+    }
+
+    EGLConfig config;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(m_Display, CONFIG_ATTRIBUTES, &config, 1, &configCount) || configCount == 0) {
+        m_Error = "no EGL config with desktop OpenGL";
+        return false;
+    }
+
+    eglBindAPI(EGL_OPENGL_API);
+    m_Context = eglCreateContext(m_Display, config, EGL_NO_CONTEXT, CONTEXT_ATTRIBUTES);
+    if (m_Context == EGL_NO_CONTEXT) {
+        m_Error = "cannot create an OpenGL 3.3 core context";
+        return false;
+    }
+    if (!eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_Context)) {
+        m_Error = "cannot make the context current without a surface";
+        return false;
+    }
+
+    // GLEW loads the core entry points before probing GLX, which fails without an X display
+    glewExperimental = GL_TRUE;
+    GLenum status = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    if (status == GLEW_ERROR_NO_GLX_DISPLAY) status = GLEW_OK;
+#endif
+    if (status != GLEW_OK) {
+        m_Error = "GLEW could not load OpenGL";
+        return false;
+    }
+    glGetError();  // glewInit can leave GL_INVALID_ENUM behind on core profiles.
+
+    glGenRenderbuffers(1, &m_Renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_Renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, m_Width, m_Height);
+
+    glGenFramebuffers(1, &m_Framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_Renderbuffer);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        m_Error = "framebuffer incomplete";
+        return false;
+    }
+
+    glViewport(0, 0, m_Width, m_Height);
+    return true;
+}
+
+void OffscreenContext::ReadPixels(std::vector<unsigned char>& rgba) const {
+    rgba.resize(static_cast<size_t>(m_Width) * m_Height * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, m_Width, m_Height, GL_RGBA, GL_UNSIGNED_BYTE, rgba.data());
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <EGL/egl.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * @class OffscreenContext
+ * @brief An OpenGL 3.3 core context with no window, rendering into its own framebuffer.
+ *
+ * Uses EGL on Mesa's surfaceless platform (falling back to the default display),
+ * so it works on build boxes with no X server or GPU; llvmpipe renders in software.
+ * The color target is an RGBA8 renderbuffer attached to an FBO that stays bound,
+ * so the regular `Renderer` draw paths land in it unchanged.
+ */
+class OffscreenContext {
+   private:
+    EGLDisplay m_Display = EGL_NO_DISPLAY;
+    EGLContext m_Context = EGL_NO_CONTEXT;
+    GLuint m_Framebuffer = 0;
+    GLuint m_Renderbuffer = 0;
+    int m_Width, m_Height;
+    std::string m_Error;  // Why the context could not be created, empty if it was.
+
+    bool Create();
+
+   public:
+    /**
+     * @brief Creates the context, makes it current and binds a `width` x `height` framebuffer.
+     */
+    OffscreenContext(int width, int height);
+    ~OffscreenContext();
+
+    OffscreenContext(const OffscreenContext&) = delete;
+    OffscreenContext& operator=(const OffscreenContext&) = delete;
+
+    inline bool IsValid() const { return m_Error.empty(); };
+    inline const std::string& GetError() const { return m_Error; };
+
+    inline int GetWidth() const { return m_Width; };
+    inline int GetHeight() const { return m_Height; };
+
+    /**
+     * @brief Copies the framebuffer into `rgba`, bottom row first, 4 bytes per pixel.
+     */
+    void ReadPixels(std::vector<unsigned char>& rgba) const;
+};
@@ -0,0 +1,183 @@
+#include "MoveGenerator.h"
+
+#include <bitset>
+
+namespace {
+
+constexpr int BOX_COL_OFFSET = Bitboard::WallBits;
+
+inline int StateIndex(int rotation, int row, int col) {
+    return (rotation * MoveGenerator::RowSpan + row + MoveGenerator::RowOffset) * MoveGenerator::ColSpan + col + BOX_COL_OFFSET;
+}
+
+inline bool InRange(int row, int col) {
+    return row >= -MoveGenerator::RowOffset && row < Bitboard::MaxRows && col >= -BOX_COL_OFFSET &&
+           col < MoveGenerator::ColSpan - BOX_COL_OFFSET;
+}
+
+/// Where a rotation's cells sit inside its box, for spotting rotations that land on the same cells.
+struct Orientation {
+    int canonical = 0;  // Lowest rotation of the shape whose cells form the same pattern.
+    int rowShift = 0;   // Empty rows below the cells.
+    int colShift = 0;   // Empty columns left of the cells.
+};
+
+/// Two states of a shape cover the same cells exactly when their canonical rotations
+/// match and their cells' bottom-left corners coincide.
+const Orientation& GetOrientation(ShapeType shape, int rotation) {
+    static const auto orientations = [] {
+        std::array<std::array<Orientation, ROTATION_COUNT>, SHAPE_COUNT> table{};
+        for (int s = 0; s < SHAPE_COUNT; s++) {
+            std::array<PieceMask, ROTATION_COUNT> normalized{};
+            for (int r = 0; r < ROTATION_COUNT; r++) {
+                const PieceMask& mask = PieceTables::GetRotation(static_cast<ShapeType>(s), r).mask;
+                Orientation& orientation = table[s][r];
+                while (!mask.rows[orientation.rowShift]) orientation.rowShift++;
+
+                uint16_t cols = 0;
+                for (uint16_t row : mask.rows) cols |= row;
+                while (!(cols >> orientation.colShift & 1)) orientation.colShift++;
+
+                for (int i = orientation.rowShift; i < 4; i++) {
+                    normalized[r].rows[i - orientation.rowShift] = mask.rows[i] >> orientation.colShift;
+                }
+                orientation.canonical = r;
+                for (int earlier = 0; earlier < r; earlier++) {
+                    if (normalized[earlier].rows == normalized[r].rows) {
+                        orientation.canonical = table[s][earlier].canonical;
+                        break;
+                    }
+                }
+            }
+        }
+        return table;
+    }();
+    return orientations[static_cast<int>(shape)][rotation];
+}
+
+/**
+ * Breadth-first search shared by `Generate` and `FindPath`. Calls `visit` for every
+ * resting state and stops early when it returns true.
+ */
+struct Search {
+    std::bitset<MoveGenerator::StateCount> visited;
+    std::array<PieceState, MoveGenerator::StateCount> queue;
+    std::array<uint16_t, MoveGenerator::StateCount> parent;
+    std::array<Input, MoveGenerator::StateCount> parentMove;
+    int head = 0, tail = 0;
+
+    void Reset() {
+        visited.reset();
+        head = tail = 0;
+    }
+
+    template <typename Visit>
+    bool Run(const Bitboard& board, const PieceState& spawn, Visit&& visit) {
+        if (!InRange(spawn.row, spawn.col) || !board.Fits(spawn.GetMask(), spawn.col, spawn.row)) return false;
+
+        Push(spawn, StateIndex(spawn.rotation, spawn.row, spawn.col), Input::HardDrop);
+        while (head < tail) {
+            int index = head;
+            PieceState state = queue[head++];
+            const PieceMask& mask = state.GetMask();
+
+            if (!board.Fits(mask, state.col, state.row - 1)) {
+                if (visit(state, index)) return true;
+            } else {
+                TryMove(board, state, index, 0, -1, Input::SoftDrop);
+            }
+            TryMove(board, state, index, -1, 0, Input::Left);
+            TryMove(board, state, index, 1, 0, Input::Right);
+            TryRotate(board, state, index, true);
+            TryRotate(board, state, index, false);
+        }
+        return false;
+    }
+
+    void Push(const PieceState& state, int stateIndex, Input move, int from = 0) {
+        visited.set(stateIndex);
+        parent[tail] = static_cast<uint16_t>(from);
+        parentMove[tail] = move;
+        queue[tail++] = state;
+    }
+
+    void TryMove(const Bitboard& board, const PieceState& state, int from, int deltaCol, int deltaRow, Input move) {
+        PieceState next = state;
+        next.col += deltaCol;
+        next.row += deltaRow;
+        if (!InRange(next.row, next.col)) return;
+
+        int stateIndex = StateIndex(next.rotation, next.row, next.col);
+        if (visited.test(stateIndex) || !board.Fits(next.GetMask(), next.col, next.row)) return;
+        Push(next, stateIndex, move, from);
+    }
+
+    void TryRotate(const Bitboard& board, const PieceState& state, int from, bool clockwise) {
+        PieceState next = state;
+        next.rotation = PieceTables::NextRotation(state.rotation, clockwise);
+        const PieceMask& mask = next.GetMask();
+
+        for (const KickOffset& kick : PieceTables::GetKicks(state.shape, state.rotation, clockwise)) {
+            int col = state.col + kick.col, row = state.row + kick.row;
+            if (!InRange(row, col) || !board.Fits(mask, col, row)) continue;
+
+            // First fitting kick decides the outcome, exactly like Grid::FindRotationKick
+            next.col = col;
+            next.row = row;
+            int stateIndex = StateIndex(next.rotation, row, col);
+            if (!visited.test(stateIndex)) Push(next, stateIndex, clockwise ? Input::RotateCW : Input::RotateCCW, from);
+            return;
+        }
+    }
+};
+
+}  // namespace
+
+int MoveGenerator::Generate(const Bitboard& board, const PieceState& spawn, std::vector<PieceState>& out) {
+    out.clear();
+
+    // Placements seen so far, by canonical rotation and the bottom-left corner of their cells
+    std::bitset<StateCount> placed;
+
+    static thread_local Search search;
+    search.Reset();
+    search.Run(board, spawn, [&](const PieceState& state, int) {
+        const Orientation& orientation = GetOrientation(state.shape, state.rotation);
+        int key = StateIndex(orientation.canonical, state.row + orientation.rowShift, state.col + orientation.colShift);
+        if (placed.test(key)) return false;
+        placed.set(key);
+        out.push_back(state);
+        return false;
+    });
+    return static_cast<int>(out.size());
+}
+
+bool MoveGenerator::FindPath(const Bitboard& board, const PieceState& spawn, const PieceState& target, InputPath& path) {
+    static thread_local Search search;
+    search.Reset();
+
+    int found = -1;
+    search.Run(board, spawn, [&](const PieceState& state, int index) {
+        if (state.rotation != target.rotation || state.col != target.col || state.row != target.row) return false;
+        found = index;
+        return true;
+    });
+    if (found < 0) return false;
+
+    // Walk back to the spawn, then reverse into spawn-to-target order
+    int length = 0;
+    std::array<Input, StateCount> reversed;
+    for (int index = found; index != 0; index = search.parent[index]) {
+        reversed[length++] = search.parentMove[index];
+    }
+
+    // Soft drops straight into the resting spot are covered by the final hard drop
+    int skip = 0;
+    while (skip < length && reversed[skip] == Input::SoftDrop) skip++;
+    if (length - skip + 1 > InputPath::MaxLength) return false;
+
+    path.length = 0;
+    while (length > skip) path.inputs[path.length++] = reversed[--length];
+    path.inputs[path.length++] = Input::HardDrop;
+    return true;
+}
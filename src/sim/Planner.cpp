@@ -0,0 +1,178 @@
+#include "Planner.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+
+#include "Random.h"
+#include "ThreadPool.h"
+#include "TranspositionTable.h"
+#include "Zobrist.h"
+
+namespace Heuristics {
+
+float Default(const Bitboard& board, int lines) {
+    uint16_t playfield = board.GetPlayfieldMask();
+    int heights[Bitboard::MaxCols] = {};
+    int holes = 0;
+
+    // Walk down from the top: the first block in a column sets its height,
+    // every empty cell under a covered column is a hole
+    uint16_t covered = 0;
+    for (int row = board.GetRows() - 1; row >= 0; row--) {
+        uint16_t blocks = board.GetRowMask(row) & playfield;
+        uint16_t fresh = blocks & ~covered;
+        for (int col = 0; fresh; col++) {
+            if (fresh & (1u << (col + Bitboard::WallBits))) {
+                heights[col] = row + 1;
+                fresh &= static_cast<uint16_t>(~(1u << (col + Bitboard::WallBits)));
+            }
+        }
+        holes += Bitboard::PopCount(covered & ~blocks & playfield);
+        covered |= blocks;
+    }
+
+    int aggregate = 0, bumpiness = 0;
+    for (int col = 0; col < board.GetCols(); col++) {
+        aggregate += heights[col];
+        if (col > 0) bumpiness += std::abs(heights[col] - heights[col - 1]);
+    }
+
+    return -0.510066f * aggregate + 0.760666f * lines - 0.35663f * holes - 0.184483f * bumpiness;
+}
+
+}  // namespace Heuristics
+
+namespace {
+
+[[maybe_unused]] bool IsDefaultHeuristic(const Heuristic& heuristic) {
+    using Function = float (*)(const Bitboard&, int);
+    const Function* function = heuristic.target<Function>();
+    return function && *function == &Heuristics::Default;
+}
+
+}  // namespace
+
+Planner::Planner(const PlannerConfig& config, Heuristic heuristic)
+    : m_Config(config), m_Heuristic(std::move(heuristic)), m_HeuristicKey(0) {
+    // Scores from another heuristic under the same key would be silently wrong
+    assert(!m_Config.table || m_Config.heuristicId != 0 || IsDefaultHeuristic(m_Heuristic));
+
+    uint64_t state = m_Config.heuristicId;
+    if (state) m_HeuristicKey = Random::SplitMix64(state);
+}
+
+void Planner::Evaluate(Node& node) {
+    // The heuristic sees (board, lines), so both go into the key. A hit returns
+    // exactly what the heuristic would, which keeps games reproducible however
+    // the table is shared.
+    node.key = node.board.GetHash() ^ Zobrist::LinesKey(node.lines) ^ m_HeuristicKey;
+    if (!m_Config.table) {
+        node.score = m_Heuristic(node.board, node.lines);
+        return;
+    }
+
+    TranspositionTable::Entry entry;
+    if (m_Config.table->Probe(node.key, entry)) {
+        m_CacheHits.fetch_add(1, std::memory_order_relaxed);
+        node.score = entry.score;
+        return;
+    }
+
+    node.score = m_Heuristic(node.board, node.lines);
+    m_Config.table->Store(node.key, {node.score, m_Generation});
+}
+
+void Planner::TrimBeam() {
+    std::sort(m_Beam.begin(), m_Beam.end(), [](const Node& a, const Node& b) { return a.score > b.score; });
+
+    // Transposed boards score the same; whichever comes first stands for them all
+    size_t width = static_cast<size_t>(m_Config.beamWidth), kept = 0;
+    for (size_t i = 0; i < m_Beam.size() && kept < width; i++) {
+        bool seen = false;
+        for (size_t j = 0; j < kept && !seen; j++) seen = m_Beam[j].key == m_Beam[i].key;
+        if (!seen) m_Beam[kept++] = m_Beam[i];
+    }
+    m_Beam.erase(m_Beam.begin() + kept, m_Beam.end());
+}
+
+void Planner::Expand(size_t nodeIndex, ShapeType shape, int cols) {
+    const Node& node = m_Beam[nodeIndex];
+    std::vector<Node>& children = m_Children[nodeIndex];
+    std::vector<PieceState>& placements = m_Placements[nodeIndex];
+    children.clear();
+
+    PieceState spawn{shape, 0, Game::GetSpawnCol(shape, cols), Game::SpawnRow};
+    MoveGenerator::Generate(node.board, spawn, placements);
+
+    for (const PieceState& placement : placements) {
+        Node child{node.board, 0.0f, node.lines, node.root, 0};
+        child.board.Place(placement.GetMask(), placement.col, placement.row);
+        child.lines += Bitboard::PopCount(child.board.ClearFullRows());
+        Evaluate(child);
+        children.push_back(child);
+    }
+}
+
+bool Planner::Plan(const Game& game, PlannerResult& result) {
+    const Tetromino& current = game.GetCurrent();
+    const Bitboard& board = game.GetGrid().GetBoard();
+    int cols = game.GetGrid().GetCols();
+
+    PieceState start{current.GetShape(), current.GetRotation(), current.GetCol(), current.GetRow()};
+    if (m_Config.table) m_Generation = m_Config.table->NewGeneration();
+    m_CacheHits = 0;
+
+    MoveGenerator::Generate(board, start, m_RootPlacements);
+    if (m_RootPlacements.empty()) return false;
+
+    // Level one: every placement of the current piece
+    m_Beam.clear();
+    for (size_t i = 0; i < m_RootPlacements.size(); i++) {
+        const PieceState& placement = m_RootPlacements[i];
+        Node node{board, 0.0f, 0, static_cast<int>(i), 0};
+        node.board.Place(placement.GetMask(), placement.col, placement.row);
+        node.lines = Bitboard::PopCount(node.board.ClearFullRows());
+        Evaluate(node);
+        m_Beam.push_back(node);
+    }
+    result.nodes = static_cast<int>(m_RootPlacements.size());
+
+    TrimBeam();
+
+    // Deeper levels: the preview pieces, one per level
+    int depth = std::min(m_Config.depth, Game::PreviewCount + 1);
+    for (int level = 1; level < depth; level++) {
+        ShapeType shape = game.GetPreview(level - 1);
+        if (m_Children.size() < m_Beam.size()) {
+            m_Children.resize(m_Beam.size());
+            m_Placements.resize(m_Beam.size());
+        }
+
+        auto expand = [&](size_t i) { Expand(i, shape, cols); };
+        if (m_Config.pool && m_Beam.size() > 1) {
+            m_Config.pool->ParallelFor(0, m_Beam.size(), 1, expand);
+        } else {
+            for (size_t i = 0; i < m_Beam.size(); i++) expand(i);
+        }
+
+        size_t total = 0;
+        for (size_t i = 0; i < m_Beam.size(); i++) total += m_Children[i].size();
+        result.nodes += static_cast<int>(total);
+        if (total == 0) break;  // Every line of play tops out here; keep the last level
+
+        size_t parents = m_Beam.size();
+        m_Beam.clear();
+        for (size_t i = 0; i < parents; i++) {
+            m_Beam.insert(m_Beam.end(), m_Children[i].begin(), m_Children[i].end());
+        }
+        TrimBeam();
+    }
+
+    result.cacheHits = m_CacheHits;
+
+    const Node& best = m_Beam.front();  // TrimBeam leaves the beam sorted best first
+    result.target = m_RootPlacements[best.root];
+    result.score = best.score;
+    return MoveGenerator::FindPath(board, start, result.target, result.path);
+}
@@ -0,0 +1,152 @@
+#include "Simulator.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "Random.h"
+#include "ThreadPool.h"
+
+namespace {
+
+std::atomic<uint64_t> s_NextPoolId{1};
+
+/// The planners of one `Policies::Beam` policy, one per thread that has called it.
+class PlannerPool {
+   private:
+    uint64_t m_Id = s_NextPoolId.fetch_add(1, std::memory_order_relaxed);  // Never reused, unlike addresses.
+    PlannerConfig m_Config;
+    std::mutex m_Mutex;
+    std::unordered_map<std::thread::id, std::unique_ptr<Planner>> m_Planners;
+
+    // The pool and planner each thread used last, so repeat calls skip the lock
+    struct CachedPlanner {
+        uint64_t pool = 0;
+        Planner* planner = nullptr;
+    };
+    static thread_local CachedPlanner t_Cached;
+
+   public:
+    explicit PlannerPool(const PlannerConfig& config) : m_Config(config) {}
+
+    /// The calling thread's planner, built from this pool's config on first use.
+    Planner& Get() {
+        if (t_Cached.pool == m_Id) return *t_Cached.planner;
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::unique_ptr<Planner>& planner = m_Planners[std::this_thread::get_id()];
+        if (!planner) planner.reset(new Planner(m_Config));
+        t_Cached = {m_Id, planner.get()};
+        return *planner;
+    }
+};
+
+thread_local PlannerPool::CachedPlanner PlannerPool::t_Cached;
+
+}  // namespace
+
+Simulator::Simulator(const SimConfig& config)
+    : m_Config(config) {
+}
+
+void Simulator::ApplyPlacement(Game& game, const Placement& placement) {
+    if (placement.path.length > 0) {
+        int pieces = game.GetPieces();
+        for (int i = 0; i < placement.path.length && game.GetPieces() == pieces; i++) {
+            game.Apply(placement.path.inputs[i]);
+        }
+        if (game.GetPieces() == pieces) game.HardDrop();
+        return;
+    }
+
+    // Turn the short way round: three clockwise turns are one counter-clockwise
+    int turns = ((placement.rotation - game.GetCurrent().GetRotation()) % ROTATION_COUNT + ROTATION_COUNT) % ROTATION_COUNT;
+    if (turns == 3) {
+        game.Rotate(false);
+    } else {
+        for (int i = 0; i < turns; i++) game.Rotate(true);
+    }
+
+    while (game.GetCurrent().GetCol() > placement.col && game.MoveLeft()) {
+    }
+    while (game.GetCurrent().GetCol() < placement.col && game.MoveRight()) {
+    }
+
+    game.HardDrop();
+}
+
+GameResult Simulator::PlayGame(uint64_t seed, const Policy& policy, int maxPieces) {
+    Game game(seed);
+    while (!game.IsGameOver() && game.GetPieces() < maxPieces) {
+        ApplyPlacement(game, policy(game));
+    }
+
+    GameResult result;
+    result.seed = seed;
+    result.score = game.GetScore();
+    result.lines = game.GetLines();
+    result.pieces = game.GetPieces();
+    result.reason = game.IsGameOver() ? EndReason::TopOut : EndReason::PieceLimit;
+    return result;
+}
+
+SimReport Simulator::Run(const Policy& policy) const {
+    SimReport report;
+    report.results.resize(m_Config.gameCount);
+
+    ThreadPool pool(m_Config.threads);
+    report.threads = pool.GetThreadCount();
+
+    auto start = std::chrono::steady_clock::now();
+    pool.ParallelFor(0, m_Config.gameCount, m_Config.gamesPerTask, [&](size_t i) {
+        report.results[i] = PlayGame(m_Config.firstSeed + i, policy, m_Config.maxPieces);
+    });
+    auto end = std::chrono::steady_clock::now();
+
+    long totalPieces = 0;
+    for (const GameResult& result : report.results) totalPieces += result.pieces;
+
+    report.seconds = std::chrono::duration<double>(end - start).count();
+    if (report.seconds > 0.0) {
+        report.gamesPerSecond = report.results.size() / report.seconds;
+        report.piecesPerSecond = totalPieces / report.seconds;
+    }
+    return report;
+}
+
+namespace Policies {
+
+Placement Random(const Game& game) {
+    uint64_t state = game.GetSeed() ^ (static_cast<uint64_t>(game.GetPieces()) << 32);
+    uint64_t value = ::Random::SplitMix64(state);
+
+    int boxSize = PieceTables::GetPiece(game.GetCurrent().GetShape()).boxSize;
+    int span = game.GetGrid().GetCols() + 4 - boxSize;  // Box origins can sit past either wall
+
+    Placement placement;
+    placement.rotation = static_cast<int>(value % ROTATION_COUNT);
+    placement.col = static_cast<int>((value >> 8) % span) - 2;
+    return placement;
+}
+
+Policy Beam(const PlannerConfig& config) {
+    // Copies of the policy share the pool; it goes away, table pointer included, with the last of them
+    auto planners = std::make_shared<PlannerPool>(config);
+    return [planners](const Game& game) {
+        Planner& planner = planners->Get();
+
+        Placement placement;
+        PlannerResult result;
+        if (planner.Plan(game, result)) {
+            placement.rotation = result.target.rotation;
+            placement.col = result.target.col;
+            placement.path = result.path;
+        }
+        return placement;
+    };
+}
+
+}  // namespace Policies
@@ -0,0 +1,142 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace {
+
+// Index of the pool worker running on this thread, or -1 outside the pool
+thread_local long t_WorkerIndex = -1;
+thread_local const ThreadPool* t_WorkerPool = nullptr;
+
+}  // namespace
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    for (size_t i = 0; i < threadCount; i++) {
+        m_Queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (size_t i = 0; i < threadCount; i++) {
+        m_Threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    Wait();
+    {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_Stop = true;
+    }
+    m_WakeCondition.notify_all();
+    for (std::thread& thread : m_Threads) thread.join();
+}
+
+void ThreadPool::Submit(Task task) {
+    // Workers keep their own children local; everyone else spreads round-robin
+    size_t index = (t_WorkerPool == this) ? static_cast<size_t>(t_WorkerIndex)
+                                          : m_NextQueue.fetch_add(1, std::memory_order_relaxed) % m_Queues.size();
+
+    m_Pending.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(m_Queues[index]->mutex);
+        m_Queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_Queued.fetch_add(1);
+    }
+    m_WakeCondition.notify_one();
+}
+
+bool ThreadPool::TryTake(size_t index, Task& task) {
+    size_t count = m_Queues.size();
+
+    {
+        WorkerQueue& own = *m_Queues[index % count];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            m_Queued.fetch_sub(1);
+            return true;
+        }
+    }
+
+    for (size_t offset = 1; offset < count; offset++) {
+        WorkerQueue& victim = *m_Queues[(index + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            m_Queued.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::RunTask(Task& task) {
+    task();
+    task = nullptr;
+
+    if (m_Pending.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_DoneCondition.notify_all();
+    }
+}
+
+void ThreadPool::WorkerLoop(size_t index) {
+    t_WorkerIndex = static_cast<long>(index);
+    t_WorkerPool = this;
+
+    Task task;
+    while (true) {
+        if (TryTake(index, task)) {
+            RunTask(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_SleepMutex);
+        m_WakeCondition.wait(lock, [this] { return m_Stop || m_Queued > 0; });
+        if (m_Stop && m_Queued == 0) return;
+    }
+}
+
+void ThreadPool::Wait() {
+    Task task;
+    while (m_Pending > 0) {
+        if (TryTake(0, task)) {
+            RunTask(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_SleepMutex);
+        m_DoneCondition.wait(lock, [this] { return m_Pending == 0; });
+    }
+}
+
+void ThreadPool::ParallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t)>& body) {
+    if (begin >= end) return;
+    grain = std::max<size_t>(grain, 1);
+
+    // Count only this loop's chunks, so nested loops do not wait on unrelated work
+    std::atomic<size_t> remaining{(end - begin + grain - 1) / grain};
+    for (size_t chunk = begin; chunk < end; chunk += grain) {
+        size_t chunkEnd = std::min(chunk + grain, end);
+        Submit([chunk, chunkEnd, &body, &remaining] {
+            for (size_t i = chunk; i < chunkEnd; i++) body(i);
+            remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    // Help out instead of blocking, then spin on whatever other workers still hold
+    size_t index = (t_WorkerPool == this) ? static_cast<size_t>(t_WorkerIndex) : 0;
+    Task task;
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (TryTake(index, task)) {
+            RunTask(task);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
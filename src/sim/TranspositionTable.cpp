@@ -0,0 +1,35 @@
+#include "TranspositionTable.h"
+
+TranspositionTable::TranspositionTable(size_t megabytes) {
+    size_t slots = 1;
+    while (slots * 2 * sizeof(Slot) <= megabytes * 1024 * 1024) slots *= 2;
+
+    m_Slots = std::make_unique<Slot[]>(slots);
+    m_Mask = slots - 1;
+}
+
+bool TranspositionTable::Probe(uint64_t key, Entry& entry) const {
+    const Slot& slot = m_Slots[key & m_Mask];
+    uint64_t data = slot.data.load(std::memory_order_relaxed);
+    uint64_t check = slot.check.load(std::memory_order_relaxed);
+
+    if (data == 0 || (check ^ data) != key) return false;
+
+    entry = Unpack(data);
+    return true;
+}
+
+void TranspositionTable::Store(uint64_t key, const Entry& entry) {
+    Slot& slot = m_Slots[key & m_Mask];
+    uint64_t data = Pack(entry);
+    if (data == 0) return;  // Would read back as an empty slot
+    slot.data.store(data, std::memory_order_relaxed);
+    slot.check.store(key ^ data, std::memory_order_relaxed);
+}
+
+void TranspositionTable::Clear() {
+    for (size_t i = 0; i <= m_Mask; i++) {
+        m_Slots[i].data.store(0, std::memory_order_relaxed);
+        m_Slots[i].check.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Bitboard.h"
+#include "Game.h"
+#include "PieceTables.h"
+
+/// A piece at a given rotation with its box origin at (col, row).
+struct PieceState {
+    ShapeType shape = ShapeType::I;
+    int rotation = 0;
+    int col = 0;
+    int row = 0;
+
+    inline const PieceMask& GetMask() const { return PieceTables::GetRotation(shape, rotation).mask; };
+};
+
+/// Fixed-capacity sequence of inputs that steers a piece to a placement.
+struct InputPath {
+    static constexpr int MaxLength = 64;
+
+    std::array<Input, MaxLength> inputs{};
+    int length = 0;
+};
+
+/**
+ * @class MoveGenerator
+ * @brief Finds every resting place a piece can reach from its spawn position.
+ *
+ * Runs a breadth-first search over (rotation, row, column) using left, right,
+ * soft drop and both rotations with SRS kicks, so tucks and spins under
+ * overhangs are found as well as plain drops. All state lives on the stack.
+ */
+class MoveGenerator {
+   public:
+    static constexpr int RowOffset = 3;  // Box origins can sit up to three rows below the floor.
+    static constexpr int RowSpan = Bitboard::MaxRows + RowOffset;
+    static constexpr int ColSpan = 16;  // Box origins from -WallBits up to the right wall.
+    static constexpr int StateCount = ROTATION_COUNT * RowSpan * ColSpan;
+
+    /**
+     * @brief Lists the distinct final placements reachable from `spawn`.
+     *
+     * Placements that cover exactly the same cells through different rotations are
+     * reported once.
+     *
+     * @param out Cleared, then filled with the resting states.
+     * @return The number of placements found.
+     */
+    static int Generate(const Bitboard& board, const PieceState& spawn, std::vector<PieceState>& out);
+
+    /**
+     * @brief Finds the shortest input sequence from `spawn` to `target`, ending in a hard drop.
+     *
+     * @return False if `target` is unreachable or the path does not fit in an `InputPath`.
+     */
+    static bool FindPath(const Bitboard& board, const PieceState& spawn, const PieceState& target, InputPath& path);
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Bitboard.h"
+#include "Game.h"
+#include "MoveGenerator.h"
+
+class ThreadPool;
+class TranspositionTable;
+
+/**
+ * @brief Scores a board after a placement; higher is better.
+ *
+ * @param board The board with the placement locked and full rows cleared.
+ * @param lines Lines cleared along the whole path from the root to this board.
+ */
+using Heuristic = std::function<float(const Bitboard& board, int lines)>;
+
+namespace Heuristics {
+
+/// Weighted aggregate height, completed lines, holes and bumpiness.
+float Default(const Bitboard& board, int lines);
+
+}  // namespace Heuristics
+
+struct PlannerConfig {
+    int depth = 3;                // Pieces to look ahead: the current one plus depth - 1 previews.
+    int beamWidth = 32;           // Boards kept after each level.
+    ThreadPool* pool = nullptr;   // Spreads each level's expansion across threads when set.
+
+    // Shares board evaluations between levels, searches and threads when set.
+    TranspositionTable* table = nullptr;
+
+    // Mixed into table keys. Planners sharing a table must agree on it exactly when
+    // they score boards the same way; a custom heuristic needs its own non-zero id.
+    uint64_t heuristicId = 0;
+};
+
+struct PlannerResult {
+    PieceState target;   // Where the current piece should land.
+    InputPath path;      // Inputs from the piece's current position, ending in a hard drop.
+    float score = 0.0f;  // Heuristic value of the best leaf.
+    int nodes = 0;       // Boards generated.
+    int cacheHits = 0;   // Evaluations answered by the transposition table.
+};
+
+/**
+ * @class Planner
+ * @brief Picks a placement for the current piece with a beam search over the preview queue.
+ *
+ * Each level places the next piece on every board in the beam, scores the
+ * children with the heuristic and keeps the best `beamWidth`. The answer is the
+ * first move of the best leaf. A board reached along several lines of play is
+ * kept once per level, so it is expanded once. Scratch buffers are kept between
+ * calls, so one Planner should be used by one thread at a time.
+ */
+class Planner {
+   private:
+    struct Node {
+        Bitboard board;
+        float score;
+        int lines;
+        int root;      // Index of the first-level placement this node descends from.
+        uint64_t key;  // Board hash with the lines and heuristic mixed in; set by `Evaluate`.
+    };
+
+    PlannerConfig m_Config;
+    Heuristic m_Heuristic;
+    uint64_t m_HeuristicKey;  // Spreads `heuristicId` over all 64 key bits.
+
+    std::vector<PieceState> m_RootPlacements;
+    std::vector<Node> m_Beam;
+    std::vector<std::vector<Node>> m_Children;           // Per beam node, filled in parallel.
+    std::vector<std::vector<PieceState>> m_Placements;  // Per beam node scratch.
+
+    uint32_t m_Generation = 0;  // Transposition tag of the running search.
+    std::atomic<int> m_CacheHits{0};
+
+    void Expand(size_t nodeIndex, ShapeType shape, int cols);
+
+    /// Sets `node.key` and `node.score`, the latter through the transposition table when there is one.
+    void Evaluate(Node& node);
+
+    /// Keeps the best `beamWidth` distinct boards, best first.
+    void TrimBeam();
+
+   public:
+    explicit Planner(const PlannerConfig& config = PlannerConfig(), Heuristic heuristic = Heuristics::Default);
+
+    /**
+     * @brief Searches for the best placement of the game's current piece.
+     *
+     * @return False if the current piece has nowhere to go.
+     */
+    bool Plan(const Game& game, PlannerResult& result);
+};
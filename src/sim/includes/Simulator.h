@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Game.h"
+#include "MoveGenerator.h"
+#include "Planner.h"
+
+/// Why a simulated game stopped.
+enum class EndReason { TopOut,
+                       PieceLimit };
+
+/**
+ * @struct Placement
+ * @brief Where a policy wants the current piece to land.
+ *
+ * If `path` is empty the piece is turned to `rotation`, shifted until its box
+ * origin reaches `col` and hard dropped; moves that are blocked on the way are
+ * simply skipped. Otherwise the inputs in `path` are played as given, which can
+ * reach tucks and spins a plain drop cannot.
+ */
+struct Placement {
+    int rotation = 0;
+    int col = 0;
+    InputPath path;
+};
+
+/**
+ * @brief Chooses a placement for the game's current piece.
+ *
+ * Called concurrently from every worker thread, each time with a different game.
+ */
+using Policy = std::function<Placement(const Game&)>;
+
+struct GameResult {
+    uint64_t seed = 0;
+    int score = 0;
+    int lines = 0;
+    int pieces = 0;
+    EndReason reason = EndReason::TopOut;
+};
+
+struct SimConfig {
+    uint64_t firstSeed = 0;    // Games use seeds firstSeed .. firstSeed + gameCount - 1.
+    uint64_t gameCount = 1000;
+    int maxPieces = 10000;     // Games that survive this long end with `PieceLimit`.
+    size_t threads = 0;        // 0 uses every hardware thread.
+    size_t gamesPerTask = 4;   // Work-stealing granularity.
+};
+
+struct SimReport {
+    std::vector<GameResult> results;  // Indexed by seed - firstSeed.
+    size_t threads = 0;
+    double seconds = 0.0;
+    double gamesPerSecond = 0.0;
+    double piecesPerSecond = 0.0;
+};
+
+/**
+ * @class Simulator
+ * @brief Plays complete headless games in parallel on a work-stealing thread pool.
+ */
+class Simulator {
+   private:
+    SimConfig m_Config;
+
+   public:
+    explicit Simulator(const SimConfig& config);
+
+    /// Plays every game in the configured seed range.
+    SimReport Run(const Policy& policy) const;
+
+    /// Plays a single game to the end on the calling thread.
+    static GameResult PlayGame(uint64_t seed, const Policy& policy, int maxPieces);
+
+    /// Moves the current piece to `placement` and hard drops it.
+    static void ApplyPlacement(Game& game, const Placement& placement);
+};
+
+namespace Policies {
+
+/// Uniformly random rotation and column, derived from the game's seed and piece count.
+Placement Random(const Game& game);
+
+/**
+ * @brief Beam-search planner policy.
+ *
+ * The policy keeps one Planner per thread that calls it, built from `config` on
+ * first use. Policies from different calls never share planners, so each can
+ * have its own configuration.
+ */
+Policy Beam(const PlannerConfig& config);
+
+}  // namespace Policies
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads with per-worker task deques and work stealing.
+ *
+ * Each worker pops from the back of its own deque and, when that runs dry, steals
+ * from the front of the others. Tasks submitted from inside a task go to the
+ * submitting worker's deque, so recursive work stays local until someone is idle.
+ */
+class ThreadPool {
+   public:
+    using Task = std::function<void()>;
+
+   private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+    std::vector<std::thread> m_Threads;
+
+    std::atomic<size_t> m_Queued{0};   // Tasks sitting in a deque.
+    std::atomic<size_t> m_Pending{0};  // Tasks submitted but not finished.
+    std::atomic<size_t> m_NextQueue{0};
+    std::atomic<bool> m_Stop{false};
+
+    std::mutex m_SleepMutex;
+    std::condition_variable m_WakeCondition;  // Workers wait here for new tasks.
+    std::condition_variable m_DoneCondition;  // `Wait` waits here for the last task.
+
+    void WorkerLoop(size_t index);
+
+    /// Takes a task from `index`'s own deque, or steals one from another worker.
+    bool TryTake(size_t index, Task& task);
+    void RunTask(Task& task);
+
+   public:
+    /**
+     * @param threadCount Number of workers; 0 uses every hardware thread.
+     */
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(Task task);
+
+    /**
+     * @brief Blocks until every submitted task has finished.
+     *
+     * The calling thread runs queued tasks while it waits. Must not be called from
+     * inside a task; use `ParallelFor` for nested work.
+     */
+    void Wait();
+
+    /**
+     * @brief Runs `body(i)` for every i in [begin, end), split into chunks of `grain`.
+     *
+     * Returns once this loop's chunks are done. The caller helps run tasks in the
+     * meantime, so it is safe to call from inside another task.
+     */
+    void ParallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t)>& body);
+
+    inline size_t GetThreadCount() const { return m_Threads.size(); };
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+/**
+ * @class TranspositionTable
+ * @brief Fixed-size, lock-free cache of board evaluations keyed by Zobrist hash.
+ *
+ * Each slot stores the packed data next to `key ^ data`. A reader only accepts a
+ * slot when the two words XOR back to the key it asked for, so a slot torn by
+ * two threads writing at once reads as a miss instead of a wrong answer. No
+ * locks are taken and entries are simply overwritten when slots collide.
+ */
+class TranspositionTable {
+   public:
+    struct Entry {
+        float score;    // Heuristic value of the board.
+        uint32_t tag;   // Caller-defined, e.g. search generation and depth.
+    };
+
+   private:
+    struct Slot {
+        std::atomic<uint64_t> check{0};  // key ^ data
+        std::atomic<uint64_t> data{0};
+    };
+
+    std::unique_ptr<Slot[]> m_Slots;
+    size_t m_Mask;
+
+    std::atomic<uint32_t> m_Generation{0};
+
+    static inline uint64_t Pack(const Entry& entry) {
+        uint32_t bits;
+        static_assert(sizeof(bits) == sizeof(entry.score), "float must be 32 bits");
+        std::memcpy(&bits, &entry.score, sizeof(bits));
+        return (static_cast<uint64_t>(entry.tag) << 32) | bits;
+    }
+
+    static inline Entry Unpack(uint64_t data) {
+        Entry entry;
+        uint32_t bits = static_cast<uint32_t>(data);
+        std::memcpy(&entry.score, &bits, sizeof(bits));
+        entry.tag = static_cast<uint32_t>(data >> 32);
+        return entry;
+    }
+
+   public:
+    /**
+     * @param megabytes Approximate size; rounded down to a power-of-two slot count.
+     */
+    explicit TranspositionTable(size_t megabytes = 16);
+
+    /**
+     * @brief Looks up a board.
+     *
+     * @return True and fills `entry` if the key is stored.
+     */
+    bool Probe(uint64_t key, Entry& entry) const;
+
+    /// Caches `entry` under `key`. An entry with tag 0 and score +0.0 packs to an empty slot and is skipped.
+    void Store(uint64_t key, const Entry& entry);
+
+    /// Forgets every entry.
+    void Clear();
+
+    /// @return A fresh number for tagging the entries of one search.
+    inline uint32_t NewGeneration() { return m_Generation.fetch_add(1, std::memory_order_relaxed) + 1; };
+
+    inline size_t GetSlotCount() const { return m_Mask + 1; };
+};